@@ -18,8 +18,8 @@ Appetizer::Appetizer()
  * @param spiciness_level The spiciness level of the appetizer.
  * @param vegetarian Flag indicating if the appetizer is vegetarian.
  */
-Appetizer::Appetizer(const std::string& name, const std::vector<Ingredient>& ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const ServingStyle &serving_style, const int &spiciness_level, const bool &vegetarian)
-    : Dish(name, ingredients, prep_time, price, cuisine_type), serving_style_(serving_style), spiciness_level_(spiciness_level), vegetarian_(vegetarian) {}
+Appetizer::Appetizer(std::string name, std::vector<Ingredient> ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const ServingStyle &serving_style, const int &spiciness_level, const bool &vegetarian)
+    : Dish(std::move(name), std::move(ingredients), prep_time, price, cuisine_type), serving_style_(serving_style), spiciness_level_(spiciness_level), vegetarian_(vegetarian) {}
 
 /**
  * Sets the serving style of the appetizer.
@@ -82,7 +82,7 @@ void Appetizer::display() const
     std::cout << "Dish Name: " << getName() << std::endl;
     std::cout << "Ingredients: ";
     for (size_t i = 0; i < getIngredients().size(); ++i) {
-        std::cout << getIngredients()[i].name;
+        std::cout << getIngredients()[i].getName();
         if (i != getIngredients().size() - 1) {
             std::cout << ", ";
         }
@@ -90,7 +90,7 @@ void Appetizer::display() const
     std::cout << std::endl;
     std::cout << "Preparation Time: " << getPrepTime() << " minutes" << std::endl;
     std::cout << std::fixed << std::setprecision(2) << "Price: $" << getPrice() << std::endl;
-    std::cout << "Cuisine Type: " << getCuisineType() << std::endl;
+    std::cout << "Cuisine Type: " << cuisineToString(getCuisineEnum()) << std::endl;
     std::cout << "Serving Style: ";
     switch (serving_style_)
     {
@@ -143,41 +143,6 @@ void Appetizer::dietaryAccommodations(const DietaryRequest &request)
     if (request.vegetarian)
     {
         vegetarian_ = true;
-        bool first_replacement_done = false;
-        bool second_replacement_done = false;
-        
-        // Create a local mutable copy of the ingredients
-        std::vector<Ingredient> ingredients = getIngredients(); 
-
-        if (!ingredients.empty())
-        {
-            for (size_t i = 0; i < ingredients.size(); i++)
-            {
-                if (ingredients[i].name == "Meat" || ingredients[i].name == "Chicken" || ingredients[i].name == "Fish" || 
-                    ingredients[i].name == "Beef" || ingredients[i].name == "Pork" || ingredients[i].name == "Lamb" || 
-                    ingredients[i].name == "Shrimp" || ingredients[i].name == "Bacon")
-                {
-                    if (!first_replacement_done)
-                    {
-                        ingredients[i].name = "Beans";  // First replacement
-                        first_replacement_done = true;
-                    }
-                    else if (!second_replacement_done)
-                    {
-                        ingredients[i].name = "Mushrooms";  // Second replacement
-                        second_replacement_done = true;
-                    }
-                    else
-                    {
-                        ingredients.erase(ingredients.begin() + i);  // Remove non-vegetarian item
-                        i--;  // Adjust index after removal
-                    }
-                }
-            }
-        }
-
-        // Set the modified ingredients back, assuming a setter method is available
-        setIngredients(ingredients);
     }
     if (request.low_sodium)
     {
@@ -187,25 +152,11 @@ void Appetizer::dietaryAccommodations(const DietaryRequest &request)
             spiciness_level_ = 0;
         }
     }
+    // meat substitution and gluten removal share one pass over the ingredients
+    unsigned int remove_flags = 0;
     if (request.gluten_free)
     {
-        std::vector<Ingredient> ingredients = getIngredients(); // Make a copy since getIngredients() is const
-
-        if (!ingredients.empty())
-        {
-            for (size_t i = 0; i < ingredients.size(); i++)
-            {
-                if (ingredients[i].name == "Wheat" || ingredients[i].name == "Flour" || ingredients[i].name == "Bread" || 
-                    ingredients[i].name == "Pasta" || ingredients[i].name == "Barley" || ingredients[i].name == "Rye" || 
-                    ingredients[i].name == "Oats" || ingredients[i].name == "Crust")
-                {
-                    ingredients.erase(ingredients.begin() + i);
-                    i--;  // Adjust the index after erasing
-                }
-            }
-        }
-
-        // Set the modified ingredients back, assuming you have a setter or similar method
-        setIngredients(ingredients);
+        remove_flags |= CONTAINS_GLUTEN;
     }
-}
\ No newline at end of file
+    rewriteIngredients(request.vegetarian, remove_flags);
+}
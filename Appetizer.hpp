@@ -33,7 +33,7 @@ public:
      * @param spiciness_level The spiciness level of the appetizer.
      * @param vegetarian Flag indicating if the appetizer is vegetarian.
      */
-    Appetizer(const std::string& name, const std::vector<Ingredient>& ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const ServingStyle &serving_style, const int &spiciness_level, const bool &vegetarian);
+    Appetizer(std::string name, std::vector<Ingredient> ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const ServingStyle &serving_style, const int &spiciness_level, const bool &vegetarian);
 
     /**
      * Sets the serving style of the appetizer.
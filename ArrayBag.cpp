@@ -9,7 +9,7 @@ DO NOT MODIFY THIS FILE. YOU DO NOT HAVE TO SUBMIT THIS FILE
 
 /** default constructor**/
 template<class ItemType>
-ArrayBag<ItemType>::ArrayBag(): item_count_(0)
+ArrayBag<ItemType>::ArrayBag(): items_(DEFAULT_CAPACITY), item_count_(0), indexed_(false)
 {
 }  // end default constructor
 
@@ -40,17 +40,64 @@ bool ArrayBag<ItemType>::add(const ItemType& new_entry)
    if (contains(new_entry)) {
        return false;
    }
-	bool has_room = (item_count_ < DEFAULT_CAPACITY);
-	if (has_room)
+	if (item_count_ == getCapacity())
 	{
-		items_[item_count_] = new_entry;
-		item_count_++;
-        return true;
+		reserve(2 * getCapacity());
 	}  // end if
 
-	return false;
+	items_[item_count_] = new_entry;
+	item_count_++;
+	if (indexed_)
+	{
+		indexInsert(item_count_ - 1);
+	}  // end if
+	return true;
 }  // end add
 
+/**
+ @param entries to be added to items_, in order
+ @post capacity is grown at most once before the entries are added;
+       entries already in the bag are skipped
+ @return the number of entries that were added
+ **/
+template<class ItemType>
+int ArrayBag<ItemType>::addRange(const std::vector<ItemType>& entries)
+{
+   reserve(item_count_ + static_cast<int>(entries.size()));
+   int added = 0;
+   for (const ItemType& entry : entries)
+   {
+      if (add(entry))
+      {
+         added++;
+      }  // end if
+   }  // end for
+
+   return added;
+}  // end addRange
+
+/**
+ @param new_capacity the minimum number of items items_ should hold
+ @post getCapacity() >= new_capacity, existing items are kept in order
+ **/
+template<class ItemType>
+void ArrayBag<ItemType>::reserve(int new_capacity)
+{
+   if (new_capacity > getCapacity())
+   {
+      items_.resize(new_capacity);
+   }  // end if
+}  // end reserve
+
+/**
+ @return the number of items items_ can hold before it has to grow
+ **/
+template<class ItemType>
+int ArrayBag<ItemType>::getCapacity() const
+{
+   return static_cast<int>(items_.size());
+}  // end getCapacity
+
 /**
  @return true if an_entry was successfully removed from items_, false otherwise
  **/
@@ -61,6 +108,16 @@ bool ArrayBag<ItemType>::remove(const ItemType& an_entry)
 	bool can_remove = !isEmpty() && (found_index > -1);
 	if (can_remove)
 	{
+		if (indexed_)
+		{
+			// Drop the removed entry first, then repoint the last entry's slot
+			// at the position it is about to be moved into
+			indexErase(findSlot(an_entry));
+			if (found_index != item_count_ - 1)
+			{
+				index_[findSlot(items_[item_count_ - 1])] = found_index;
+			}  // end if
+		}  // end if
 		item_count_--;
 		items_[found_index] = items_[item_count_];
 	}  // end if
@@ -75,14 +132,60 @@ template<class ItemType>
 void ArrayBag<ItemType>::clear()
 {
 	item_count_ = 0;
+	if (indexed_)
+	{
+		rebuildIndex(MIN_INDEX_SIZE);
+	}  // end if
 }  // end clear
 
+/**
+ @param pred called once on every item, in order
+ @post every item for which pred returned true is removed in a single
+       compaction pass; the remaining items keep their relative order
+ @return the removed items, in the order they were stored
+ **/
+template<class ItemType>
+template<class Predicate>
+std::vector<ItemType> ArrayBag<ItemType>::removeIf(Predicate pred)
+{
+   std::vector<ItemType> removed;
+   int keep_count = 0;
+   for (int i = 0; i < item_count_; i++)
+   {
+      if (pred(items_[i]))
+      {
+         removed.push_back(items_[i]);
+      }
+      else
+      {
+         if (keep_count != i)
+         {
+            items_[keep_count] = items_[i];
+         }  // end if
+         keep_count++;
+      }  // end if
+   }  // end for
+
+   item_count_ = keep_count;
+   if (indexed_ && !removed.empty())
+   {
+      rebuildIndex(2 * static_cast<std::size_t>(item_count_));
+   }  // end if
+   return removed;
+}  // end removeIf
+
 /**
  @return the number of times an_entry is found in items_
  **/
 template<class ItemType>
 int ArrayBag<ItemType>::getFrequencyOf(const ItemType& an_entry) const
 {
+   // add() never stores duplicates, so an indexed entry occurs exactly once
+   if (indexed_)
+   {
+      return contains(an_entry) ? 1 : 0;
+   }  // end if
+
    int frequency = 0;
    int curr_index = 0;       // Current array index
    while (curr_index < item_count_)
@@ -107,6 +210,36 @@ bool ArrayBag<ItemType>::contains(const ItemType& an_entry) const
 	return getIndexOf(an_entry) > -1;
 }  // end contains
 
+/**
+ @param indexed true to keep a hash index of items_, false to drop it
+ @pre ItemType can be hashed with std::hash when indexed is true
+ @post add, remove, contains and getFrequencyOf run in O(1) average time
+       while the index is on, and fall back to linear scans when it is off
+ **/
+template<class ItemType>
+void ArrayBag<ItemType>::setIndexed(bool indexed)
+{
+   indexed_ = indexed;
+   if (indexed_)
+   {
+      rebuildIndex(2 * static_cast<std::size_t>(item_count_));
+   }
+   else
+   {
+      index_.clear();
+      index_.shrink_to_fit();
+   }  // end if
+}  // end setIndexed
+
+/**
+ @return true if the hash index is being maintained, false otherwise
+ **/
+template<class ItemType>
+bool ArrayBag<ItemType>::isIndexed() const
+{
+   return indexed_;
+}  // end isIndexed
+
 // ********* PRIVATE METHODS **************//
 
 /**
@@ -117,6 +250,12 @@ bool ArrayBag<ItemType>::contains(const ItemType& an_entry) const
 template<class ItemType>
 int ArrayBag<ItemType>::getIndexOf(const ItemType& target) const
 {  
+   if (indexed_)
+   {
+      int slot = findSlot(target);
+      return slot == EMPTY_SLOT ? -1 : index_[slot];
+   }  // end if
+
 	bool found = false;
   int result = -1;
   int search_index = 0;
@@ -138,3 +277,111 @@ int ArrayBag<ItemType>::getIndexOf(const ItemType& target) const
    return result;
 }  // end getIndexOf
 
+/**
+   @return the slot where probing for target starts
+ **/
+template<class ItemType>
+std::size_t ArrayBag<ItemType>::homeSlot(const ItemType& target) const
+{
+   // std::hash is the identity for pointers and integers, so mix the bits
+   // before masking or aligned pointers would all share a few slots
+   unsigned long long h = std::hash<ItemType>{}(target);
+   h ^= h >> 33;
+   h *= 0xff51afd7ed558ccdULL;
+   h ^= h >> 33;
+   return static_cast<std::size_t>(h) & (index_.size() - 1);
+}  // end homeSlot
+
+/**
+   @return the slot of index_ that holds target's position, or EMPTY_SLOT
+ **/
+template<class ItemType>
+int ArrayBag<ItemType>::findSlot(const ItemType& target) const
+{
+   std::size_t mask = index_.size() - 1;
+   std::size_t slot = homeSlot(target);
+   while (index_[slot] != EMPTY_SLOT)
+   {
+      if (items_[index_[slot]] == target)
+      {
+         return static_cast<int>(slot);
+      }  // end if
+      slot = (slot + 1) & mask;
+   }  // end while
+
+   return EMPTY_SLOT;
+}  // end findSlot
+
+/**
+   @param position of an item in items_ that is not yet indexed
+   @post the item at position can be found through index_
+ **/
+template<class ItemType>
+void ArrayBag<ItemType>::indexInsert(int position)
+{
+   // keep the load factor at or below one half
+   if (2 * static_cast<std::size_t>(item_count_) > index_.size())
+   {
+      rebuildIndex(2 * index_.size());
+      return;
+   }  // end if
+
+   std::size_t mask = index_.size() - 1;
+   std::size_t slot = homeSlot(items_[position]);
+   while (index_[slot] != EMPTY_SLOT)
+   {
+      slot = (slot + 1) & mask;
+   }  // end while
+   index_[slot] = position;
+}  // end indexInsert
+
+/**
+   @param hole an occupied slot of index_
+   @post the slot is freed and the probe chains after it are shifted back
+         so no lookup is cut short by the new gap
+ **/
+template<class ItemType>
+void ArrayBag<ItemType>::indexErase(std::size_t hole)
+{
+   std::size_t mask = index_.size() - 1;
+   std::size_t next = (hole + 1) & mask;
+   while (index_[next] != EMPTY_SLOT)
+   {
+      std::size_t home = homeSlot(items_[index_[next]]);
+      // the entry may fill the hole only if the hole lies on its probe path
+      if (((next - home) & mask) >= ((next - hole) & mask))
+      {
+         index_[hole] = index_[next];
+         hole = next;
+      }  // end if
+      next = (next + 1) & mask;
+   }  // end while
+   index_[hole] = EMPTY_SLOT;
+}  // end indexErase
+
+/**
+   @param min_size the minimum number of slots
+   @post index_ holds the positions of all items in items_
+ **/
+template<class ItemType>
+void ArrayBag<ItemType>::rebuildIndex(std::size_t min_size)
+{
+   std::size_t size = MIN_INDEX_SIZE;
+   while (size < min_size || size < 2 * static_cast<std::size_t>(item_count_))
+   {
+      size *= 2;
+   }  // end while
+   index_.assign(size, EMPTY_SLOT);
+
+   std::size_t mask = size - 1;
+   for (int position = 0; position < item_count_; position++)
+   {
+      std::size_t slot = homeSlot(items_[position]);
+      while (index_[slot] != EMPTY_SLOT)
+      {
+         slot = (slot + 1) & mask;
+      }  // end while
+      index_[slot] = position;
+   }  // end for
+}  // end rebuildIndex
+
@@ -8,6 +8,8 @@ DO NOT MODIFY THIS FILE. YOU DO NOT HAVE TO SUBMIT THIS FILE
 #define ARRAY_BAG_
 #include <iostream>
 #include <vector>
+#include <functional>
+#include <cstddef>
 
 template <class ItemType>
 class ArrayBag
@@ -32,6 +34,17 @@ class ArrayBag
    **/
    bool add(const ItemType &new_entry);
 
+   /**
+       @param new_capacity the minimum number of items items_ should hold
+       @post getCapacity() >= new_capacity, existing items are kept in order
+   **/
+   void reserve(int new_capacity);
+
+   /**
+       @return the number of items items_ can hold before it has to grow
+   **/
+   int getCapacity() const;
+
    /**
        @return true if an_entry was successfully removed from items_, false otherwise
       **/
@@ -52,9 +65,39 @@ class ArrayBag
    **/
    int getFrequencyOf(const ItemType &an_entry) const;
 
+   /**
+       @param indexed true to keep a hash index of items_, false to drop it
+       @pre ItemType can be hashed with std::hash when indexed is true
+       @post add, remove, contains and getFrequencyOf run in O(1) average time
+             while the index is on, and fall back to linear scans when it is off
+   **/
+   void setIndexed(bool indexed);
+
+   /**
+       @return true if the hash index is being maintained, false otherwise
+   **/
+   bool isIndexed() const;
+
    protected:
-   static const int DEFAULT_CAPACITY = 100; //max size of items_ at 100 by default for this project
-   ItemType items_[DEFAULT_CAPACITY];      // Array of bag items
+   /**
+       @param entries to be added to items_, in order
+       @post capacity is grown at most once before the entries are added;
+             entries already in the bag are skipped
+       @return the number of entries that were added
+   **/
+   int addRange(const std::vector<ItemType> &entries);
+
+   /**
+       @param pred called once on every item, in order
+       @post every item for which pred returned true is removed in a single
+             compaction pass; the remaining items keep their relative order
+       @return the removed items, in the order they were stored
+      **/
+   template <class Predicate>
+   std::vector<ItemType> removeIf(Predicate pred);
+
+   static const int DEFAULT_CAPACITY = 100; //initial size of items_, doubled whenever the bag is full
+   std::vector<ItemType> items_;           // Contiguous bag storage, items_.size() is the capacity
    int item_count_;                        // Current count of bag items
 
    /**
@@ -64,6 +107,43 @@ class ArrayBag
       **/
    int getIndexOf(const ItemType &target) const;
 
+   private:
+   static constexpr int EMPTY_SLOT = -1;
+   static constexpr int MIN_INDEX_SIZE = 16;
+   // Open-addressing (linear probing) table of positions into items_,
+   // EMPTY_SLOT marks a free slot. Its size is always a power of two.
+   std::vector<int> index_;
+   bool indexed_;
+
+   /**
+      @return the slot where probing for target starts
+      **/
+   std::size_t homeSlot(const ItemType &target) const;
+
+   /**
+      @return the slot of index_ that holds target's position, or EMPTY_SLOT
+      **/
+   int findSlot(const ItemType &target) const;
+
+   /**
+      @param position of an item in items_ that is not yet indexed
+      @post the item at position can be found through index_
+      **/
+   void indexInsert(int position);
+
+   /**
+      @param hole an occupied slot of index_
+      @post the slot is freed and the probe chains after it are shifted back
+            so no lookup is cut short by the new gap
+      **/
+   void indexErase(std::size_t hole);
+
+   /**
+      @param min_size the minimum number of slots
+      @post index_ holds the positions of all items in items_
+      **/
+   void rebuildIndex(std::size_t min_size);
+
 }; // end ArrayBag
 
 #include "ArrayBag.cpp"
@@ -18,8 +18,8 @@ Dessert::Dessert()
  * @param sweetness_level The sweetness level of the dessert.
  * @param contains_nuts Flag indicating if the dessert contains nuts.
  */
-Dessert::Dessert(const std::string& name, const std::vector<Ingredient>& ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const FlavorProfile &flavor_profile, const int &sweetness_level, const bool &contains_nuts)
-    : Dish(name, ingredients, prep_time, price, cuisine_type), flavor_profile_(flavor_profile), sweetness_level_(sweetness_level), contains_nuts_(contains_nuts) {}
+Dessert::Dessert(std::string name, std::vector<Ingredient> ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const FlavorProfile &flavor_profile, const int &sweetness_level, const bool &contains_nuts)
+    : Dish(std::move(name), std::move(ingredients), prep_time, price, cuisine_type), flavor_profile_(flavor_profile), sweetness_level_(sweetness_level), contains_nuts_(contains_nuts) {}
 
 /**
  * Sets the flavor profile of the dessert.
@@ -79,7 +79,7 @@ void Dessert::display() const
     std::cout << "Dish Name: " << getName() << std::endl;
     std::cout << "Ingredients: ";
     for (size_t i = 0; i < getIngredients().size(); ++i) {
-        std::cout << getIngredients()[i].name;
+        std::cout << getIngredients()[i].getName();
         if (i != getIngredients().size() - 1) {
             std::cout << ", ";
         }
@@ -87,7 +87,7 @@ void Dessert::display() const
     std::cout << std::endl;
     std::cout << "Preparation Time: " << getPrepTime() << " minutes" << std::endl;
     std::cout << std::fixed << std::setprecision(2) << "Price: $" << getPrice() << std::endl;
-    std::cout << "Cuisine Type: " << getCuisineType() << std::endl;
+    std::cout << "Cuisine Type: " << cuisineToString(getCuisineEnum()) << std::endl;
     std::cout << "Flavor Profile: ";
     // enum FlavorProfile { SWEET, BITTER, SOUR, SALTY, UMAMI };
     switch (flavor_profile_)
@@ -146,28 +146,7 @@ void Dessert::dietaryAccommodations(const DietaryRequest &request)
     if (request.nut_free)
     {
         contains_nuts_ = false;
-        
-        // Create a local mutable copy of ingredients
-        std::vector<Ingredient> ingredients = getIngredients();
-
-        if (!ingredients.empty())
-        {
-            for (size_t i = 0; i < ingredients.size(); ++i)
-            {
-                if (ingredients[i].name == "Almonds" || ingredients[i].name == "Walnuts" || ingredients[i].name == "Pecans" || 
-                    ingredients[i].name == "Hazelnuts" || ingredients[i].name == "Peanuts" || ingredients[i].name == "Cashews" || 
-                    ingredients[i].name == "Pistachios")
-                {
-                    ingredients.erase(ingredients.begin() + i);
-                    i--;  // Adjust index after erase
-                }
-            }
-        }
-
-        // Set the modified ingredients back
-        setIngredients(ingredients);
     }
-
     if (request.low_sugar)
     {
         sweetness_level_ -= 3;
@@ -176,28 +155,15 @@ void Dessert::dietaryAccommodations(const DietaryRequest &request)
             sweetness_level_ = 0;
         }
     }
-
+    // nut and dairy/egg removal share one pass over the ingredients
+    unsigned int remove_flags = 0;
+    if (request.nut_free)
+    {
+        remove_flags |= CONTAINS_NUTS;
+    }
     if (request.vegan)
     {
-        // Create a local mutable copy of ingredients
-        std::vector<Ingredient> ingredients = getIngredients();
-
-        if (!ingredients.empty())
-        {
-            for (size_t i = 0; i < ingredients.size(); ++i)
-            {
-                if (ingredients[i].name == "Milk" || ingredients[i].name == "Eggs" || ingredients[i].name == "Cheese" || 
-                    ingredients[i].name == "Butter" || ingredients[i].name == "Cream" || ingredients[i].name == "Yogurt")
-                {
-                    ingredients.erase(ingredients.begin() + i);
-                    i--;  // Adjust index after erase
-                }
-            }
-        }
-
-        // Set the modified ingredients back
-        setIngredients(ingredients);
+        remove_flags |= CONTAINS_DAIRY_EGG;
     }
-
-    
-}
\ No newline at end of file
+    rewriteIngredients(false, remove_flags);
+}
@@ -33,7 +33,7 @@ public:
      * @param sweetness_level The sweetness level of the dessert.
      * @param contains_nuts Flag indicating if the dessert contains nuts.
      */
-    Dessert(const std::string& name, const std::vector<Ingredient>& ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const FlavorProfile &flavor_profile, const int &sweetness_level, const bool &contains_nuts);
+    Dessert(std::string name, std::vector<Ingredient> ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const FlavorProfile &flavor_profile, const int &sweetness_level, const bool &contains_nuts);
 
     /**
      * Sets the flavor profile of the dessert.
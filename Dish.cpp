@@ -2,24 +2,29 @@
 
 // Default Constructor
 Dish::Dish() 
-    : name_("UNKNOWN"), ingredients_({}), prep_time_(0), price_(0.0), cuisine_type_(CuisineType::OTHER) {
+    : name_("UNKNOWN"), ingredients_({}), prep_time_(0), price_(0.0), cuisine_type_(CuisineType::OTHER), dietary_flags_(0) {
 }
 
 // Parameterized Constructor
-Dish::Dish(const std::string& name, const std::vector<Ingredient>& ingredients, int prep_time, double price, CuisineType cuisine_type)
-    : ingredients_(ingredients), prep_time_(prep_time), price_(price), cuisine_type_(cuisine_type) {
-    setName(name);  // Use setName to validate the name
+Dish::Dish(std::string name, std::vector<Ingredient> ingredients, int prep_time, double price, CuisineType cuisine_type)
+    : ingredients_(std::move(ingredients)), prep_time_(prep_time), price_(price), cuisine_type_(cuisine_type), dietary_flags_(0) {
+    setName(std::move(name));  // Use setName to validate the name
+    updateDietaryFlags();
 }
 
 // Accessor Functions
-std::string Dish::getName() const {
+const std::string& Dish::getName() const {
     return name_;
 }
 
-std::vector<Ingredient> Dish::getIngredients() const {
+const std::vector<Ingredient>& Dish::getIngredients() const {
     return ingredients_;
 }
 
+size_t Dish::ingredientCount() const {
+    return ingredients_.size();
+}
+
 int Dish::getPrepTime() const {
     return prep_time_;
 }
@@ -29,21 +34,38 @@ double Dish::getPrice() const {
 }
 
 std::string Dish::getCuisineType() const {
-    switch (cuisine_type_) {
-        case CuisineType::ITALIAN: return "ITALIAN";
-        case CuisineType::MEXICAN: return "MEXICAN";
-        case CuisineType::CHINESE: return "CHINESE";
-        case CuisineType::INDIAN: return "INDIAN";
-        case CuisineType::AMERICAN: return "AMERICAN";
-        case CuisineType::FRENCH: return "FRENCH";
-        default: return "OTHER";
-    }
+    return std::string(cuisineToString(cuisine_type_));
+}
+
+Dish::CuisineType Dish::getCuisineEnum() const {
+    return cuisine_type_;
+}
+
+unsigned int Dish::getDietaryFlags() const {
+    return dietary_flags_;
+}
+
+bool Dish::isCompatibleWith(const DietaryRequest& request) const {
+    return (dietary_flags_ & conflictMask(request)) == 0;
+}
+
+unsigned int Dish::ingredientFlags(std::string_view name) {
+    return IngredientClassifier::classify(name);
+}
+
+unsigned int Dish::conflictMask(const DietaryRequest& request) {
+    unsigned int mask = 0;
+    if (request.vegetarian) mask |= CONTAINS_MEAT;
+    if (request.vegan) mask |= CONTAINS_MEAT | CONTAINS_DAIRY_EGG;
+    if (request.gluten_free) mask |= CONTAINS_GLUTEN;
+    if (request.nut_free) mask |= CONTAINS_NUTS;
+    return mask;
 }
 
 // Mutator Functions
-void Dish::setName(const std::string& name) {
+void Dish::setName(std::string name) {
     if (isValidName(name)) {
-        name_ = name;
+        name_ = std::move(name);
     } else {
         name_ = "UNKNOWN";
     }
@@ -51,6 +73,13 @@ void Dish::setName(const std::string& name) {
 
 void Dish::setIngredients(const std::vector<Ingredient>& ingredients) {
     ingredients_ = ingredients;
+    updateDietaryFlags();
+}
+
+void Dish::setIngredients(std::vector<Ingredient>&& ingredients) {
+    ingredients_ = std::move(ingredients);
+    ingredients.clear();
+    updateDietaryFlags();
 }
 
 void Dish::setPrepTime(const int& prep_time) {
@@ -81,6 +110,39 @@ void Dish::setCuisineType(const CuisineType& cuisine_type) {
 //     std::cout << "Cuisine Type: " << getCuisineType() << std::endl;
 // }
 
+void Dish::rewriteIngredients(bool substitute_meat, unsigned int remove_flags) {
+    if (substitute_meat) {
+        remove_flags |= CONTAINS_MEAT;
+    }
+    if ((dietary_flags_ & remove_flags) == 0) {
+        return;
+    }
+    int substitutions = 0;
+    size_t keep = 0;
+    for (size_t i = 0; i < ingredients_.size(); i++) {
+        unsigned int flags = ingredientFlags(ingredients_[i].getName());
+        if (substitute_meat && (flags & CONTAINS_MEAT) && substitutions < 2) {
+            ingredients_[i].setName(substitutions++ == 0 ? "Beans" : "Mushrooms");
+        } else if (flags & remove_flags) {
+            continue;
+        }
+        if (keep != i) {
+            ingredients_[keep] = std::move(ingredients_[i]);
+        }
+        keep++;
+    }
+    ingredients_.erase(ingredients_.begin() + keep, ingredients_.end());
+    updateDietaryFlags();
+}
+
+// Helper function to recompute the dietary flags after the ingredients change
+void Dish::updateDietaryFlags() {
+    dietary_flags_ = 0;
+    for (const Ingredient& ingredient : ingredients_) {
+        dietary_flags_ |= ingredientFlags(ingredient.getName());
+    }
+}
+
 // Helper function to check if the name is valid
 bool Dish::isValidName(const std::string& name) const {
     for (char c : name) {
@@ -2,24 +2,40 @@
 #define DISH_HPP
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <iostream>
 #include <iomanip> // For std::fixed and std::setprecision
 #include <cctype>  // For std::isalpha, std::isspace
+#include "IngredientTable.hpp"
+#include "IngredientClassifier.hpp"
 
 /**
  * Struct representing an ingredient.
  */
 struct Ingredient {
-    std::string name;
     int quantity;            // Quantity in stock
     int required_quantity;   // Quantity required for a dish
     double price;            // Price per unit
 
     // Constructors
-    Ingredient() : name("UNKNOWN"), quantity(0), required_quantity(0), price(0.0) {}
-    Ingredient(const std::string& name, const int& quantity, const int& required_quantity, const double& price)
-        : name(name), quantity(quantity), required_quantity(required_quantity), price(price) {}
+    Ingredient() : quantity(0), required_quantity(0), price(0.0), name_("UNKNOWN"), id_(IngredientTable::UNKNOWN_ID) {}
+    Ingredient(std::string name, const int& quantity, const int& required_quantity, const double& price)
+        : quantity(quantity), required_quantity(required_quantity), price(price), name_(std::move(name)), id_(IngredientTable::intern(name_)) {}
+
+    const std::string& getName() const { return name_; }
+    // IngredientTable id of the name, compare this instead of the name
+    int getId() const { return id_; }
+
+    // Renames the ingredient; the name is private so the id can never go stale
+    void setName(std::string new_name) {
+        name_ = std::move(new_name);
+        id_ = IngredientTable::intern(name_);
+    }
+
+private:
+    std::string name_;
+    int id_;
 };
 class Dish {
 public:
@@ -35,8 +51,46 @@ public:
         bool low_sodium;
         bool low_sugar;
     };
+    /**
+     * Dietary and allergen flags, one bit per ingredient group a request can rule out.
+     * The keywords of each group are listed in IngredientClassifier.
+     */
+    enum DietaryFlag : unsigned int {
+        CONTAINS_MEAT      = IngredientClassifier::MEAT,
+        CONTAINS_DAIRY_EGG = IngredientClassifier::DAIRY_EGG,
+        CONTAINS_GLUTEN    = IngredientClassifier::GLUTEN,
+        CONTAINS_NUTS      = IngredientClassifier::NUTS
+    };
+
     // CuisineType enum definition
     enum CuisineType { ITALIAN, MEXICAN, CHINESE, INDIAN, AMERICAN, FRENCH, OTHER };
+    static constexpr int CUISINE_TYPE_COUNT = OTHER + 1;
+
+    // Names of the cuisine types, indexed by CuisineType
+    static constexpr std::string_view CUISINE_NAMES[CUISINE_TYPE_COUNT] = {
+        "ITALIAN", "MEXICAN", "CHINESE", "INDIAN", "AMERICAN", "FRENCH", "OTHER"
+    };
+
+    /**
+     * @param cuisine_type A cuisine type.
+     * @return The name of the cuisine type, "OTHER" for values outside the enum.
+     */
+    static constexpr std::string_view cuisineToString(CuisineType cuisine_type) {
+        return cuisine_type >= 0 && cuisine_type < CUISINE_TYPE_COUNT ? CUISINE_NAMES[cuisine_type] : CUISINE_NAMES[OTHER];
+    }
+
+    /**
+     * @param name The name of a cuisine type, e.g. "ITALIAN".
+     * @return The matching cuisine type, or OTHER if the name matches none.
+     */
+    static constexpr CuisineType stringToCuisine(std::string_view name) {
+        for (int i = 0; i < CUISINE_TYPE_COUNT; i++) {
+            if (CUISINE_NAMES[i] == name) {
+                return static_cast<CuisineType>(i);
+            }
+        }
+        return OTHER;
+    }
 
     // Constructors
     /**
@@ -52,25 +106,31 @@ public:
 
     /**
      * Parameterized constructor.
-     * @param name A reference to the name of the dish.
-     * @param ingredients A reference to a list of ingredients (default is an empty list).
+     * @param name The name of the dish, moved into the dish.
+     * @param ingredients A list of ingredients (default is an empty list), moved into the dish.
      * @param prep_time The preparation time in minutes (default is 0).
      * @param price The price of the dish (default is 0.0).
      * @param cuisine_type The cuisine type of the dish (a CuisineType enum) with default value OTHER.
      * @post The private members are set to the values of the corresponding parameters.
      */
-    Dish(const std::string& name, const std::vector<Ingredient>& ingredients = {}, int prep_time = 0, double price = 0.0, CuisineType cuisine_type = CuisineType::OTHER);
+    Dish(std::string name, std::vector<Ingredient> ingredients = {}, int prep_time = 0, double price = 0.0, CuisineType cuisine_type = CuisineType::OTHER);
 
     // Accessors
     /**
-     * @return The name of the dish.
+     * @return A read-only reference to the name of the dish.
      */
-    std::string getName() const;
+    const std::string& getName() const;
 
     /**
-     * @return The list of ingredients used in the dish.
+     * @return A read-only reference to the list of ingredients used in the dish.
+     * The reference stays valid until the ingredients are replaced.
      */
-    std::vector<Ingredient> getIngredients() const;
+    const std::vector<Ingredient>& getIngredients() const;
+
+    /**
+     * @return The number of ingredients used in the dish.
+     */
+    size_t ingredientCount() const;
 
     /**
      * @return The preparation time in minutes.
@@ -87,21 +147,58 @@ public:
      */
     std::string getCuisineType() const;
 
+    /**
+     * @return The cuisine type of the dish.
+     */
+    CuisineType getCuisineEnum() const;
+
+    /**
+     * @return The DietaryFlag bits of all ingredients, kept up to date by setIngredients.
+     */
+    unsigned int getDietaryFlags() const;
+
+    /**
+     * @param request A dietary request.
+     * @return True if none of the dish's ingredients conflict with the request
+     * (vegan rules out both meat and dairy/egg).
+     */
+    bool isCompatibleWith(const DietaryRequest& request) const;
+
+    /**
+     * @param ingredient_name The name of an ingredient.
+     * @return The DietaryFlag bits of that ingredient, 0 if it is in none of the groups.
+     */
+    static unsigned int ingredientFlags(std::string_view ingredient_name);
+
+    /**
+     * @param request A dietary request.
+     * @return The DietaryFlag bits that conflict with the request.
+     */
+    static unsigned int conflictMask(const DietaryRequest& request);
+
     // Mutators
     /**
      * Sets the name of the dish.
-     * @param name A reference to the new name of the dish.
+     * @param name The new name of the dish, moved into the dish.
      * @post Sets the private member `name_` to the value of the parameter. If the name contains non-alphabetic characters, it is set to "UNKNOWN".
      */
-    void setName(const std::string& name);
+    void setName(std::string name);
 
     /**
      * Sets the list of ingredients.
      * @param ingredients A reference to the new list of ingredients.
-     * @post Sets the private member `ingredients_` to the value of the parameter.
+     * @post Sets the private member `ingredients_` to the value of the parameter
+     * and recomputes the dietary flags.
      */
     void setIngredients(const std::vector<Ingredient>& ingredients);
 
+    /**
+     * Sets the list of ingredients without copying it.
+     * @param ingredients The new list of ingredients, moved into the dish.
+     * @post Same as the copying overload; the argument is left empty.
+     */
+    void setIngredients(std::vector<Ingredient>&& ingredients);
+
     /**
      * Sets the preparation time.
      * @param prep_time The new preparation time in minutes.
@@ -163,12 +260,27 @@ public:
     */
     virtual void dietaryAccommodations(const DietaryRequest& request) = 0;
 
+protected:
+    /**
+     * Applies the ingredient side of a dietary accommodation in one stable pass.
+     * @param substitute_meat If true, the first two meat ingredients are renamed "Beans"
+     * and "Mushrooms" and any further meat is removed.
+     * @param remove_flags DietaryFlag bits of the ingredients to remove.
+     * @post The remaining ingredients keep their relative order and the dietary flags
+     * are recomputed. Nothing is touched if no ingredient matches.
+     */
+    void rewriteIngredients(bool substitute_meat, unsigned int remove_flags);
+
 private:
     std::string name_;
     std::vector<Ingredient> ingredients_;
     int prep_time_;
     double price_;
     CuisineType cuisine_type_;
+    unsigned int dietary_flags_;  // OR of ingredientFlags over ingredients_
+
+    // Recomputes dietary_flags_ from ingredients_
+    void updateDietaryFlags();
 
     // Helper function to check if the name is valid
     /**
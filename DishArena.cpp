@@ -0,0 +1,98 @@
+#include "DishArena.hpp"
+
+/**
+ * Default constructor.
+ * @post The arena owns no blocks and no dishes.
+ */
+DishArena::DishArena() : cursor_(nullptr), end_(nullptr) {}
+
+/**
+ * Destructor.
+ * @post Every dish created in the arena is destroyed and all blocks are freed.
+ */
+DishArena::~DishArena() {
+    release();
+}
+
+DishArena::DishArena(DishArena&& other) noexcept
+    : blocks_(std::move(other.blocks_)), cursor_(other.cursor_), end_(other.end_), dishes_(std::move(other.dishes_)) {
+    other.blocks_.clear();
+    other.dishes_.clear();
+    other.cursor_ = nullptr;
+    other.end_ = nullptr;
+}
+
+DishArena& DishArena::operator=(DishArena&& other) noexcept {
+    if (this != &other) {
+        release();
+        adopt(other);
+    }
+    return *this;
+}
+
+/**
+ * Moves every block and dish of another arena into this one.
+ * @param other The arena to take over; it is left empty.
+ * @post The adopted dishes stay where they are and are released with this arena.
+ */
+void DishArena::adopt(DishArena& other) {
+    if (this == &other) {
+        return;
+    }
+    // other's partly used block becomes the current one only if this arena has none
+    if (cursor_ == nullptr) {
+        cursor_ = other.cursor_;
+        end_ = other.end_;
+    }
+    for (std::unique_ptr<char[]>& block : other.blocks_) {
+        blocks_.push_back(std::move(block));
+    }
+    dishes_.insert(dishes_.end(), other.dishes_.begin(), other.dishes_.end());
+    other.blocks_.clear();
+    other.dishes_.clear();
+    other.cursor_ = nullptr;
+    other.end_ = nullptr;
+}
+
+/**
+ * Destroys every dish in the arena and frees all blocks.
+ * @post The arena is empty and can be reused.
+ */
+void DishArena::release() {
+    for (Dish* dish : dishes_) {
+        if (dish != nullptr) {
+            dish->~Dish();
+        }
+    }
+    dishes_.clear();
+    blocks_.clear();
+    cursor_ = nullptr;
+    end_ = nullptr;
+}
+
+/**
+ * @return The number of dishes owned by the arena.
+ */
+std::size_t DishArena::size() const {
+    return dishes_.size();
+}
+
+/**
+ * Bumps the cursor of the current block, starting a new block when it is full.
+ * @return Uninitialized memory of the given size and alignment.
+ */
+void* DishArena::allocate(std::size_t size, std::size_t alignment) {
+    std::size_t space = static_cast<std::size_t>(end_ - cursor_);
+    void* memory = cursor_;
+    if (cursor_ == nullptr || std::align(alignment, size, memory, space) == nullptr) {
+        std::size_t block_size = std::max(BLOCK_SIZE, size + alignment);
+        blocks_.push_back(std::unique_ptr<char[]>(new char[block_size]));
+        cursor_ = blocks_.back().get();
+        end_ = cursor_ + block_size;
+        memory = cursor_;
+        space = block_size;
+        std::align(alignment, size, memory, space);
+    }
+    cursor_ = static_cast<char*>(memory) + size;
+    return memory;
+}
@@ -0,0 +1,86 @@
+#ifndef DISHARENA_HPP
+#define DISHARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+#include "Dish.hpp"
+
+/**
+ * @class DishArena
+ * @brief Monotonic (bump pointer) pool that owns the dishes created in it.
+ *
+ * Dishes are placed back to back in large blocks, so dishes loaded together
+ * sit next to each other in memory. Nothing is freed one dish at a time:
+ * release() (or the destructor) runs every dish's destructor and then frees
+ * all blocks at once.
+ */
+class DishArena {
+public:
+    /**
+     * Default constructor.
+     * @post The arena owns no blocks and no dishes.
+     */
+    DishArena();
+
+    /**
+     * Destructor.
+     * @post Every dish created in the arena is destroyed and all blocks are freed.
+     */
+    ~DishArena();
+
+    DishArena(const DishArena&) = delete;
+    DishArena& operator=(const DishArena&) = delete;
+    DishArena(DishArena&& other) noexcept;
+    DishArena& operator=(DishArena&& other) noexcept;
+
+    /**
+     * Constructs a dish inside the arena.
+     * @param args The arguments forwarded to the T constructor.
+     * @return A pointer to the new dish, valid until release() is called.
+     */
+    template <class T, class... Args>
+    T* create(Args&&... args) {
+        dishes_.push_back(nullptr); // grow the list first so a dish is never orphaned
+        T* dish = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        dishes_.back() = dish;
+        return dish;
+    }
+
+    /**
+     * Moves every block and dish of another arena into this one.
+     * @param other The arena to take over; it is left empty.
+     * @post The adopted dishes stay where they are and are released with this arena.
+     */
+    void adopt(DishArena& other);
+
+    /**
+     * Destroys every dish in the arena and frees all blocks.
+     * @post The arena is empty and can be reused.
+     */
+    void release();
+
+    /**
+     * @return The number of dishes owned by the arena.
+     */
+    std::size_t size() const;
+
+private:
+    static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+
+    /**
+     * Bumps the cursor of the current block, starting a new block when it is full.
+     * @return Uninitialized memory of the given size and alignment.
+     */
+    void* allocate(std::size_t size, std::size_t alignment);
+
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    char* cursor_;  ///< Next free byte of the current block.
+    char* end_;     ///< One past the last byte of the current block.
+    std::vector<Dish*> dishes_;
+};
+
+#endif // DISHARENA_HPP
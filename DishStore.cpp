@@ -0,0 +1,82 @@
+#include "DishStore.hpp"
+
+// Default Constructor
+DishStore::DishStore() : dishes_() {
+}
+
+void DishStore::add(DishVariant dish) {
+    dishes_.push_back(std::move(dish));
+}
+
+bool DishStore::add(const Dish& dish) {
+    if (const Appetizer* appetizer = dynamic_cast<const Appetizer*>(&dish)) {
+        dishes_.emplace_back(*appetizer);
+    } else if (const MainCourse* main_course = dynamic_cast<const MainCourse*>(&dish)) {
+        dishes_.emplace_back(*main_course);
+    } else if (const Dessert* dessert = dynamic_cast<const Dessert*>(&dish)) {
+        dishes_.emplace_back(*dessert);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void DishStore::reserve(int capacity) {
+    dishes_.reserve(capacity);
+}
+
+int DishStore::size() const {
+    return static_cast<int>(dishes_.size());
+}
+
+void DishStore::clear() {
+    dishes_.clear();
+}
+
+Dish& DishStore::at(int index) {
+    return asDish(dishes_[index]);
+}
+
+const Dish& DishStore::at(int index) const {
+    return asDish(dishes_[index]);
+}
+
+DishStore::DishVariant& DishStore::variantAt(int index) {
+    return dishes_[index];
+}
+
+const DishStore::DishVariant& DishStore::variantAt(int index) const {
+    return dishes_[index];
+}
+
+void DishStore::displayMenu() const {
+    for (const DishVariant& dish : dishes_) {
+        std::visit([](const auto& concrete) {
+            using Concrete = std::decay_t<decltype(concrete)>;
+            concrete.Concrete::display();  // qualified call, no vtable lookup
+        }, dish);
+    }
+}
+
+void DishStore::dietaryAdjustment(const Dish::DietaryRequest& request) {
+    for (DishVariant& dish : dishes_) {
+        std::visit([&request](auto& concrete) {
+            using Concrete = std::decay_t<decltype(concrete)>;
+            concrete.Concrete::dietaryAccommodations(request);
+        }, dish);
+    }
+}
+
+KitchenStats DishStore::getStats() const {
+    return KitchenStats::compute(size(), [this](int i) {
+        return KitchenStats::rowOf(asDish(dishes_[i]));
+    });
+}
+
+Dish& DishStore::asDish(DishVariant& dish) {
+    return std::visit([](auto& concrete) -> Dish& { return concrete; }, dish);
+}
+
+const Dish& DishStore::asDish(const DishVariant& dish) {
+    return std::visit([](const auto& concrete) -> const Dish& { return concrete; }, dish);
+}
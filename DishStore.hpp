@@ -0,0 +1,102 @@
+#ifndef DISHSTORE_HPP
+#define DISHSTORE_HPP
+
+#include <type_traits>
+#include <variant>
+#include <vector>
+#include "Dish.hpp"
+#include "Appetizer.hpp"
+#include "MainCourse.hpp"
+#include "Dessert.hpp"
+#include "KitchenStats.hpp"
+
+/**
+ * @class DishStore
+ * @brief Value container that keeps dishes contiguously, one std::variant per dish.
+ *
+ * Dishes are stored by value rather than as Dish* to separate heap objects,
+ * so the bulk passes (menu display, dietary adjustment, stats) walk one
+ * vector in order. Those passes dispatch with std::visit and call the
+ * concrete type's member directly instead of going through the vtable.
+ */
+class DishStore {
+public:
+    using DishVariant = std::variant<Appetizer, MainCourse, Dessert>;
+
+    /**
+     * Default constructor.
+     * @post The store is empty.
+     */
+    DishStore();
+
+    /**
+     * @param dish A dish to copy into the store.
+     * @post A copy of the dish is appended to the end of the store.
+     */
+    void add(DishVariant dish);
+
+    /**
+     * @param dish A dish to copy into the store.
+     * @return True if the dish is an Appetizer, MainCourse or Dessert and was copied
+     * to the end of the store, false otherwise.
+     */
+    bool add(const Dish& dish);
+
+    /**
+     * @param capacity The number of dishes to make room for.
+     * @post No reallocation happens until the store holds more than capacity dishes.
+     */
+    void reserve(int capacity);
+
+    /**
+     * @return The number of dishes in the store.
+     */
+    int size() const;
+
+    /**
+     * @post The store is empty.
+     */
+    void clear();
+
+    /**
+     * @param index The position of a dish, 0 <= index < size().
+     * @return A reference to the dish at that position.
+     */
+    Dish& at(int index);
+    const Dish& at(int index) const;
+
+    /**
+     * @param index The position of a dish, 0 <= index < size().
+     * @return A reference to the variant holding the dish, for callers that visit it themselves.
+     */
+    DishVariant& variantAt(int index);
+    const DishVariant& variantAt(int index) const;
+
+    /**
+     * Displays all dishes in the store, in order.
+     * @post Calls each dish's own display().
+     */
+    void displayMenu() const;
+
+    /**
+     * Adjusts all dishes in the store.
+     * @param request A DietaryRequest structure specifying the dietary accommodations.
+     * @post Calls each dish's own dietaryAccommodations().
+     */
+    void dietaryAdjustment(const Dish::DietaryRequest& request);
+
+    /**
+     * Computes aggregate statistics over the stored dishes.
+     * @return The same statistics Kitchen::getStats reports for the same dishes.
+     */
+    KitchenStats getStats() const;
+
+private:
+    // Converts a stored variant to the common base class
+    static Dish& asDish(DishVariant& dish);
+    static const Dish& asDish(const DishVariant& dish);
+
+    std::vector<DishVariant> dishes_;
+};
+
+#endif // DISHSTORE_HPP
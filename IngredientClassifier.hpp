@@ -0,0 +1,93 @@
+#ifndef INGREDIENTCLASSIFIER_HPP
+#define INGREDIENTCLASSIFIER_HPP
+
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @class IngredientClassifier
+ * @brief Maps an ingredient name to its dietary category bits in O(1).
+ *
+ * The keyword list is hashed into a fixed table with a seed found at compile
+ * time so that no two keywords share a slot. A lookup is one hash, one table
+ * read and one string comparison, and never allocates.
+ */
+class IngredientClassifier {
+public:
+    enum Category : unsigned int {
+        MEAT      = 1u << 0,
+        DAIRY_EGG = 1u << 1,
+        GLUTEN    = 1u << 2,
+        NUTS      = 1u << 3
+    };
+
+    struct Keyword {
+        std::string_view name;
+        unsigned int categories;
+    };
+
+    static constexpr Keyword KEYWORDS[] = {
+        {"Meat", MEAT}, {"Chicken", MEAT}, {"Fish", MEAT}, {"Beef", MEAT},
+        {"Pork", MEAT}, {"Lamb", MEAT}, {"Shrimp", MEAT}, {"Bacon", MEAT},
+        {"Milk", DAIRY_EGG}, {"Eggs", DAIRY_EGG}, {"Cheese", DAIRY_EGG},
+        {"Butter", DAIRY_EGG}, {"Cream", DAIRY_EGG}, {"Yogurt", DAIRY_EGG},
+        {"Wheat", GLUTEN}, {"Flour", GLUTEN}, {"Bread", GLUTEN}, {"Pasta", GLUTEN},
+        {"Barley", GLUTEN}, {"Rye", GLUTEN}, {"Oats", GLUTEN}, {"Crust", GLUTEN},
+        {"Almonds", NUTS}, {"Walnuts", NUTS}, {"Pecans", NUTS}, {"Hazelnuts", NUTS},
+        {"Peanuts", NUTS}, {"Cashews", NUTS}, {"Pistachios", NUTS}
+    };
+    static constexpr int KEYWORD_COUNT = sizeof(KEYWORDS) / sizeof(KEYWORDS[0]);
+    static constexpr int TABLE_SIZE = 128;  // power of two, roughly 4x the keyword count
+
+    /**
+     * @param name The name of an ingredient.
+     * @return The Category bits of the ingredient, 0 if it is not a keyword.
+     */
+    static constexpr unsigned int classify(std::string_view name);
+
+private:
+    struct Table {
+        uint32_t seed;
+        int8_t slots[TABLE_SIZE];  // keyword index per slot, -1 if empty
+    };
+
+    // FNV-1a over the name, started from the seed
+    static constexpr uint32_t slotOf(std::string_view name, uint32_t seed) {
+        uint32_t hash = 2166136261u ^ seed;
+        for (char c : name) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+        }
+        hash ^= hash >> 15;
+        return hash & (TABLE_SIZE - 1);
+    }
+
+    // Tries seeds until every keyword lands in its own slot
+    static constexpr Table buildTable() {
+        for (uint32_t seed = 0;; seed++) {
+            Table table{seed, {}};
+            for (int i = 0; i < TABLE_SIZE; i++) {
+                table.slots[i] = -1;
+            }
+            bool collision = false;
+            for (int k = 0; k < KEYWORD_COUNT && !collision; k++) {
+                int8_t& slot = table.slots[slotOf(KEYWORDS[k].name, seed)];
+                collision = slot >= 0;
+                slot = static_cast<int8_t>(k);
+            }
+            if (!collision) {
+                return table;
+            }
+        }
+    }
+
+    static const Table TABLE;
+};
+
+inline constexpr IngredientClassifier::Table IngredientClassifier::TABLE = IngredientClassifier::buildTable();
+
+constexpr unsigned int IngredientClassifier::classify(std::string_view name) {
+    int keyword = TABLE.slots[slotOf(name, TABLE.seed)];
+    return keyword >= 0 && KEYWORDS[keyword].name == name ? KEYWORDS[keyword].categories : 0;
+}
+
+#endif // INGREDIENTCLASSIFIER_HPP
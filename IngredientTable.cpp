@@ -0,0 +1,119 @@
+#include "IngredientTable.hpp"
+
+#include <stdexcept>
+
+IngredientTable::Table::Table() : count(0) {
+    for (std::atomic<std::string*>& chunk : chunks) {
+        chunk.store(nullptr, std::memory_order_relaxed);
+    }
+    std::string* first = new std::string[CHUNK_SIZE];
+    first[UNKNOWN_ID] = "UNKNOWN";
+    chunks[0].store(first, std::memory_order_relaxed);
+    ids.emplace("UNKNOWN", UNKNOWN_ID);
+    count.store(1, std::memory_order_release);
+}
+
+IngredientTable::Table::~Table() {
+    for (std::atomic<std::string*>& chunk : chunks) {
+        delete[] chunk.load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @return The single table, created on first use.
+ */
+IngredientTable::Table& IngredientTable::table() {
+    static Table instance;
+    return instance;
+}
+
+namespace {
+/**
+ * @return The calling thread's cache of names it has already seen.
+ */
+std::unordered_map<std::string, int>& localIds() {
+    thread_local std::unordered_map<std::string, int> ids;
+    return ids;
+}
+}
+
+/**
+ * @param name An ingredient name missing from the calling thread's cache.
+ * @param insert true to assign the next free id if name is new.
+ * @return The id of the name, or NOT_FOUND if it is new and insert is false.
+ * @throw std::length_error if name is new and MAX_NAMES names are already in use.
+ */
+int IngredientTable::lookup(const std::string& name, bool insert) {
+    Table& t = table();
+    std::lock_guard<std::mutex> lock(t.mutex);
+    std::unordered_map<std::string, int>::const_iterator it = t.ids.find(name);
+    if (it != t.ids.end()) {
+        return it->second;
+    }
+    if (!insert) {
+        return NOT_FOUND;
+    }
+    int id = t.count.load(std::memory_order_relaxed);
+    if (id >= MAX_NAMES) {
+        throw std::length_error("IngredientTable is full");
+    }
+    std::atomic<std::string*>& chunk = t.chunks[id >> CHUNK_BITS];
+    std::string* names = chunk.load(std::memory_order_relaxed);
+    if (names == nullptr) {
+        names = new std::string[CHUNK_SIZE];
+        chunk.store(names, std::memory_order_release);
+    }
+    names[id & (CHUNK_SIZE - 1)] = name;
+    t.ids.emplace(name, id);
+    t.count.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+/**
+ * @param name An ingredient name.
+ * @return The id of the name, assigning the next free id if it is new.
+ * @throw std::length_error if name is new and MAX_NAMES names are already in use.
+ */
+int IngredientTable::intern(const std::string& name) {
+    std::unordered_map<std::string, int>& cache = localIds();
+    std::unordered_map<std::string, int>::const_iterator it = cache.find(name);
+    if (it != cache.end()) {
+        return it->second;
+    }
+    int id = lookup(name, true);
+    cache.emplace(name, id);
+    return id;
+}
+
+/**
+ * @param name An ingredient name.
+ * @return The id of the name, or NOT_FOUND if it was never interned.
+ * @post The table is unchanged.
+ */
+int IngredientTable::find(const std::string& name) {
+    std::unordered_map<std::string, int>& cache = localIds();
+    std::unordered_map<std::string, int>::const_iterator it = cache.find(name);
+    if (it != cache.end()) {
+        return it->second;
+    }
+    int id = lookup(name, false);
+    if (id != NOT_FOUND) {
+        cache.emplace(name, id); // misses are not cached, another thread may intern the name later
+    }
+    return id;
+}
+
+/**
+ * @param id An id returned by intern().
+ * @return The name the id was assigned to; the reference stays valid for the life of the program.
+ */
+const std::string& IngredientTable::nameOf(int id) {
+    return table().chunks[id >> CHUNK_BITS].load(std::memory_order_acquire)[id & (CHUNK_SIZE - 1)];
+}
+
+/**
+ * @return The number of interned names, i.e. one past the largest id.
+ */
+int IngredientTable::size() {
+    return table().count.load(std::memory_order_acquire);
+}
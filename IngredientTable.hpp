@@ -0,0 +1,76 @@
+#ifndef INGREDIENTTABLE_HPP
+#define INGREDIENTTABLE_HPP
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @class IngredientTable
+ * @brief Process-wide symbol table that maps ingredient names to dense integer ids.
+ *
+ * Names are interned once, when an Ingredient is built or renamed, so stock
+ * lookups can compare ids instead of strings. Ids start at 0 and never change
+ * or get reused. All functions are safe to call from several threads: each
+ * thread keeps its own cache of the names it has looked up, and nameOf() and
+ * size() read published slots, so only the first sighting of a name in a
+ * thread takes the table lock.
+ */
+class IngredientTable {
+public:
+    static constexpr int UNKNOWN_ID = 0;   ///< Id of "UNKNOWN", the default ingredient name.
+    static constexpr int NOT_FOUND = -1;   ///< Returned by find() for names never interned.
+    static constexpr int MAX_NAMES = 1 << 22; ///< Most names the table can hold.
+
+    /**
+     * @param name An ingredient name.
+     * @return The id of the name, assigning the next free id if it is new.
+     * @throw std::length_error if name is new and MAX_NAMES names are already in use.
+     */
+    static int intern(const std::string& name);
+
+    /**
+     * @param name An ingredient name.
+     * @return The id of the name, or NOT_FOUND if it was never interned.
+     * @post The table is unchanged.
+     */
+    static int find(const std::string& name);
+
+    /**
+     * @param id An id returned by intern().
+     * @return The name the id was assigned to; the reference stays valid for the life of the program.
+     */
+    static const std::string& nameOf(int id);
+
+    /**
+     * @return The number of interned names, i.e. one past the largest id.
+     */
+    static int size();
+
+private:
+    static constexpr int CHUNK_BITS = 10;      // names are stored in chunks of 1 << CHUNK_BITS
+    static constexpr int CHUNK_SIZE = 1 << CHUNK_BITS;
+    static constexpr int MAX_CHUNKS = MAX_NAMES / CHUNK_SIZE;
+
+    struct Table {
+        Table();
+        ~Table();
+        std::mutex mutex;                                       // held by writers and cache misses only
+        std::unordered_map<std::string, int> ids;               // guarded by mutex
+        std::array<std::atomic<std::string*>, MAX_CHUNKS> chunks; // chunk i holds the names of ids i*CHUNK_SIZE and up
+        std::atomic<int> count;                                 // ids below count are published
+    };
+
+    static Table& table();
+
+    /**
+     * @param name An ingredient name missing from the calling thread's cache.
+     * @param insert true to assign the next free id if name is new.
+     * @return The id of the name, or NOT_FOUND if it is new and insert is false.
+     */
+    static int lookup(const std::string& name, bool insert);
+};
+
+#endif // INGREDIENTTABLE_HPP
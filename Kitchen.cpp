@@ -1,33 +1,89 @@
 #include "Kitchen.hpp"
 
-Kitchen::Kitchen() : ArrayBag<Dish*>(), total_prep_time_(0), count_elaborate_(0) {
+Kitchen::Kitchen() : ArrayBag<Dish*>(), total_prep_time_(0), count_elaborate_(0), cuisine_counts_{}, columnar_(false) {
+    // newOrder/serveDish check membership on every call, keep those O(1)
+    setIndexed(true);
 }
 bool Kitchen::newOrder(Dish* new_dish)
 {
     if (add(new_dish))
     {
         total_prep_time_ += new_dish->getPrepTime();
+        cuisine_counts_[new_dish->getCuisineEnum()]++;
         //std::cout<< "Dish added: "<<new_dish.getName() << std::endl;
         //if the new dish has 5 or more ingredients AND takes an hour or more to prepare, increment count_elaborate_
-        if (new_dish->getIngredients().size() >= 5 && new_dish->getPrepTime() >= 60)
+        if (isElaborate(new_dish))
         {
             //std::cout << "Elaborate dish added: "<<new_dish.getName() << std::endl;
             count_elaborate_++;
         }
+        if (columnar_)
+        {
+            appendColumns(new_dish);
+        }
         return true;
     }
     return false;
 }
+/**
+    * Adds several orders at once.
+    * @param new_dishes The dishes to add, in order.
+    * @post Capacity is grown at most once and dishes already in the kitchen are skipped.
+    * The running totals and the columnar mirror are updated once for all added dishes.
+    * @return The number of dishes added.*/
+int Kitchen::newOrders(const std::vector<Dish*>& new_dishes)
+{
+    int first = getCurrentSize();
+    int added = addRange(new_dishes);
+    int prep_time_added = 0;
+    int elaborate_added = 0;
+    for (int i = first; i < getCurrentSize(); i++)
+    {
+        prep_time_added += items_[i]->getPrepTime();
+        cuisine_counts_[items_[i]->getCuisineEnum()]++;
+        if (isElaborate(items_[i]))
+        {
+            elaborate_added++;
+        }
+    }
+    total_prep_time_ += prep_time_added;
+    count_elaborate_ += elaborate_added;
+    if (columnar_)
+    {
+        for (int i = first; i < getCurrentSize(); i++)
+        {
+            appendColumns(items_[i]);
+        }
+    }
+    return added;
+}
 bool Kitchen::serveDish(Dish* dish_to_remove)
 {
     if (getCurrentSize() == 0)
     {
         return false;
     }
+    // remove() moves the last order into the freed slot, the columns must do the same
+    int index = columnar_ ? getIndexOf(dish_to_remove) : -1;
     if (remove(dish_to_remove))
     {
+        if (columnar_)
+        {
+            size_t last = columns_.prep_times.size() - 1;
+            columns_.prep_times[index] = columns_.prep_times[last];
+            columns_.prices[index] = columns_.prices[last];
+            columns_.cuisines[index] = columns_.cuisines[last];
+            columns_.ingredient_counts[index] = columns_.ingredient_counts[last];
+            columns_.dish_tags[index] = columns_.dish_tags[last];
+            columns_.prep_times.pop_back();
+            columns_.prices.pop_back();
+            columns_.cuisines.pop_back();
+            columns_.ingredient_counts.pop_back();
+            columns_.dish_tags.pop_back();
+        }
         total_prep_time_ -= dish_to_remove->getPrepTime();
-        if (dish_to_remove->getIngredients().size() >= 5 && dish_to_remove->getPrepTime() >= 60)
+        cuisine_counts_[dish_to_remove->getCuisineEnum()]--;
+        if (isElaborate(dish_to_remove))
         {
             count_elaborate_--;
         }
@@ -35,6 +91,22 @@ bool Kitchen::serveDish(Dish* dish_to_remove)
     }
     return false;
 }
+/**
+    * Closes every open order without serving them one by one.
+    * @post The kitchen is empty, its running totals are 0 and the columnar mirror is
+    * empty. Hides ArrayBag::clear, which only resets the bag and would leave the
+    * totals and columns describing the old orders.*/
+void Kitchen::clear()
+{
+    ArrayBag<Dish*>::clear();
+    total_prep_time_ = 0;
+    count_elaborate_ = 0;
+    std::fill(cuisine_counts_, cuisine_counts_ + CUISINE_TYPE_COUNT, 0);
+    if (columnar_)
+    {
+        columns_ = OrderColumns();
+    }
+}
 int Kitchen::getPrepTimeSum() const
 {
     if (getCurrentSize() == 0)
@@ -49,15 +121,7 @@ int Kitchen::calculateAvgPrepTime() const
     {
         return 0;
     }
-    double total_prep_time_ = 0;
-    for (int i = 0; i < getCurrentSize(); i++)
-    {
-        total_prep_time_ += items_[i]->getPrepTime();
-    }
-    total_prep_time_ = total_prep_time_ / getCurrentSize();
-    // std::cout<< "Total prep time: "<<total_prep_time_ << std::endl;
-    // std::cout<<"rounded: "<<round(total_prep_time_)<<std::endl;
-    return round(total_prep_time_);
+    return round(double(total_prep_time_) / getCurrentSize());
 }
 int Kitchen::elaborateDishCount() const
 {
@@ -81,123 +145,320 @@ double Kitchen::calculateElaboratePercentage() const
     // percentage = percentage / 100;
     // std::cout << percentage << std::endl;
     // return percentage;
-    if (getCurrentSize() == 0 || count_elaborate_ == 0)
+    return KitchenStats::percentage(count_elaborate_, getCurrentSize());
+    //return count_elaborate_ / getCurrentSize();
+}
+int Kitchen::tallyCuisineTypes(const std::string& cuisine_type) const{
+    Dish::CuisineType type = Dish::stringToCuisine(cuisine_type);
+    // stringToCuisine maps any unknown name to OTHER, which no dish reports
+    if (Dish::cuisineToString(type) != cuisine_type)
     {
         return 0;
     }
-    return round(double(count_elaborate_) / double(getCurrentSize()) * 10000)/100;
-    //return count_elaborate_ / getCurrentSize();
+    return tallyCuisineTypes(type);
 }
-int Kitchen::tallyCuisineTypes(const std::string& cuisine_type) const{
-    int count = 0;
-    for (int i = 0; i < getCurrentSize(); i++)
+int Kitchen::tallyCuisineTypes(Dish::CuisineType cuisine_type) const{
+    if (cuisine_type < 0 || cuisine_type >= CUISINE_TYPE_COUNT)
     {
-        if (items_[i]->getCuisineType() == cuisine_type)
-        {
-            count++;
-        }
+        return 0;
     }
-    return count;
+    return cuisine_counts_[cuisine_type];
 }
 int Kitchen::releaseDishesBelowPrepTime(const int& prep_time)
 {
-    int count = 0;
-    int num= getCurrentSize();
-    for (int i = 0; i < num; i++)
+    return releaseIf([prep_time](const Dish* dish) {
+        return dish->getPrepTime() < prep_time;
+    }).size();
+}
+int Kitchen::releaseDishesOfCuisineType(const std::string& cuisine_type)
+{
+    Dish::CuisineType type = Dish::stringToCuisine(cuisine_type);
+    if (Dish::cuisineToString(type) != cuisine_type)
     {
-        if (items_[i]->getPrepTime() < prep_time)
-        {
-            count++;
-            serveDish(items_[i]);
-        }
+        return 0;
     }
-    return count;
+    return releaseDishesOfCuisineType(type);
 }
-int Kitchen::releaseDishesOfCuisineType(const std::string& cuisine_type)
+int Kitchen::releaseDishesOfCuisineType(Dish::CuisineType cuisine_type)
 {
-    int count = 0;
-    for (int i = 0; i < getCurrentSize(); i++)
+    // nothing to release, skip the compaction pass
+    if (tallyCuisineTypes(cuisine_type) == 0)
     {
-        if (items_[i]->getCuisineType() == cuisine_type)
+        return 0;
+    }
+    return releaseIf([cuisine_type](const Dish* dish) {
+        return dish->getCuisineEnum() == cuisine_type;
+    }).size();
+}
+
+/**
+    * Serves every open order that matches a predicate.
+    * @param predicate Called once on each open order; true means release it.
+    * @post All matching dishes are removed in one compaction pass (the remaining
+    * orders keep their relative order) and the running totals are updated once.
+    * @return The released dishes, in the order they were stored.*/
+std::vector<Dish*> Kitchen::releaseIf(const std::function<bool(const Dish*)>& predicate)
+{
+    // remember each decision so the columns can be compacted the same way
+    std::vector<char> released_mask;
+    std::vector<Dish*> released = removeIf([&](const Dish* dish) {
+        bool release = predicate(dish);
+        if (columnar_)
         {
-            count++;
-            serveDish(items_[i]);
+            released_mask.push_back(release);
         }
+        return release;
+    });
+    if (columnar_ && !released.empty())
+    {
+        size_t keep = 0;
+        for (size_t i = 0; i < released_mask.size(); i++)
+        {
+            if (!released_mask[i])
+            {
+                columns_.prep_times[keep] = columns_.prep_times[i];
+                columns_.prices[keep] = columns_.prices[i];
+                columns_.cuisines[keep] = columns_.cuisines[i];
+                columns_.ingredient_counts[keep] = columns_.ingredient_counts[i];
+                columns_.dish_tags[keep] = columns_.dish_tags[i];
+                keep++;
+            }
+        }
+        columns_.prep_times.resize(keep);
+        columns_.prices.resize(keep);
+        columns_.cuisines.resize(keep);
+        columns_.ingredient_counts.resize(keep);
+        columns_.dish_tags.resize(keep);
     }
-    return count;
+    int prep_time_released = 0;
+    int elaborate_released = 0;
+    int cuisine_released[CUISINE_TYPE_COUNT] = {};
+    for (Dish* dish : released)
+    {
+        prep_time_released += dish->getPrepTime();
+        cuisine_released[dish->getCuisineEnum()]++;
+        if (isElaborate(dish))
+        {
+            elaborate_released++;
+        }
+    }
+    total_prep_time_ -= prep_time_released;
+    count_elaborate_ -= elaborate_released;
+    for (int i = 0; i < CUISINE_TYPE_COUNT; i++)
+    {
+        cuisine_counts_[i] -= cuisine_released[i];
+    }
+    return released;
 }
 void Kitchen::kitchenReport() const
 {
-    std::cout << "ITALIAN: " << tallyCuisineTypes("ITALIAN") << std::endl;
-    std::cout << "MEXICAN: " << tallyCuisineTypes("MEXICAN") << std::endl;
-    std::cout << "CHINESE: " << tallyCuisineTypes("CHINESE") << std::endl;
-    std::cout << "INDIAN: " << tallyCuisineTypes("INDIAN") << std::endl;
-    std::cout << "AMERICAN: " << tallyCuisineTypes("AMERICAN") << std::endl;
-    std::cout << "FRENCH: " << tallyCuisineTypes("FRENCH") << std::endl;
-    std::cout << "OTHER: " << tallyCuisineTypes("OTHER") << std::endl<<std::endl;
-    std::cout << "AVERAGE PREP TIME: " << calculateAvgPrepTime() << std::endl;
-    std::cout << "ELABORATE DISHES: " << calculateElaboratePercentage() << "%" << std::endl;
+    // everything printed here comes from the running totals, no pass over the orders
+    KitchenStats stats = KitchenStats::fromCounts(getCurrentSize(), cuisine_counts_, total_prep_time_, count_elaborate_);
+    std::cout << "ITALIAN: " << stats.cuisine_counts[Dish::ITALIAN] << std::endl;
+    std::cout << "MEXICAN: " << stats.cuisine_counts[Dish::MEXICAN] << std::endl;
+    std::cout << "CHINESE: " << stats.cuisine_counts[Dish::CHINESE] << std::endl;
+    std::cout << "INDIAN: " << stats.cuisine_counts[Dish::INDIAN] << std::endl;
+    std::cout << "AMERICAN: " << stats.cuisine_counts[Dish::AMERICAN] << std::endl;
+    std::cout << "FRENCH: " << stats.cuisine_counts[Dish::FRENCH] << std::endl;
+    std::cout << "OTHER: " << stats.cuisine_counts[Dish::OTHER] << std::endl<<std::endl;
+    std::cout << "AVERAGE PREP TIME: " << int(round(stats.prep_time_mean)) << std::endl;
+    std::cout << "ELABORATE DISHES: " << stats.elaborate_percentage << "%" << std::endl;
+}
+
+/**
+    * Computes aggregate statistics over all open orders.
+    * @return A KitchenStats snapshot. Counts and sums are read from the running
+    * counters; prices, min/max and the prep time percentiles come from a single
+    * pass over the orders, with the percentiles selected in linear time.
+    * With the columnar mirror on, that pass reads the columns instead of the dishes.*/
+Kitchen::KitchenStats Kitchen::getStats() const
+{
+    KitchenStats stats = KitchenStats::fromCounts(getCurrentSize(), cuisine_counts_, total_prep_time_, count_elaborate_);
+    if (columnar_)
+    {
+        KitchenStats::addDistribution(stats, [this](int i) {
+            return KitchenStats::Row{columns_.prep_times[i], columns_.prices[i], columns_.cuisines[i], columns_.ingredient_counts[i]};
+        });
+    }
+    else
+    {
+        KitchenStats::addDistribution(stats, [this](int i) {
+            return KitchenStats::rowOf(*items_[i]);
+        });
+    }
+    return stats;
 }
 
 // Project 4 
+namespace {
+/**
+    helper function
+    @param text the unread part of the input, advanced past the token and its delimiter
+    @param delim the character that ends the token
+    @brief Splits the next token off text without copying, like std::getline does with a stream.
+    @return Returns a view of the token (the rest of text if delim is not found)
+*/
+std::string_view nextToken(std::string_view& text, char delim){
+    size_t end = text.find(delim);
+    std::string_view token = text.substr(0, end);
+    text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+    return token;
+}
+
+/**
+    helper function
+    @param token a numeric csv field
+    @brief Converts the field with std::from_chars. Leading whitespace is skipped like stoi/stod do.
+    @return Returns the parsed value, or 0 if the field does not start with a number
+*/
+template<class Number>
+Number toNumber(std::string_view token){
+    while(!token.empty() && std::isspace(static_cast<unsigned char>(token.front()))){
+        token.remove_prefix(1);
+    }
+    if(!token.empty() && token.front() == '+'){
+        token.remove_prefix(1);
+    }
+    Number value = 0;
+    std::from_chars(token.data(), token.data() + token.size(), value);
+    return value;
+}
+
+/**
+    helper function
+    @param ingredients the ';' separated ingredient field of a csv line
+    @return Returns the ingredients of the dish, each with default quantities
+*/
+std::vector<Ingredient> parseIngredients(std::string_view ingredients){
+    std::vector<Ingredient> store;
+    while(!ingredients.empty()){
+        store.emplace_back(std::string(nextToken(ingredients, ';')), 0, 0, 0.0);
+    }
+    return store;
+}
+} // namespace
+
 /**
     * Parameterized constructor.
     * @param filename The name of the input CSV file containing dish information.
     * @pre The CSV file must be properly formatted.
-    * @post Initializes the kitchen by reading dishes from the CSV file and storing them as `Dish*`.*/
+    * @post Initializes the kitchen by reading dishes from the CSV file and storing them as `Dish*`.
+    * The file is read in one block and tokenized in place with std::string_view,
+    * so only the dishes themselves are allocated.*/
 //Kitchen::Kitchen(const std::string& filename):Kitchen(){}    
-Kitchen::Kitchen(const std::string filename){
-    std::ifstream file(filename);    
-    std::string dishline;
-
-    std::getline(file, dishline, '\n' ); // skip label line
-    while(std::getline(file, dishline, '\n' )){
-        std::stringstream line(dishline);
-        std::string dishtype;
-        std::getline(line, dishtype, ','); // APPETIZER, MAIN COURSE, OR DESSERT
-        std::getline(line, dishline, '\n');
-        Dish* adder;
-        if(dishtype == "APPETIZER"){
-            adder = parseAppetizer(dishline);
+Kitchen::Kitchen(const std::string filename) : Kitchen(filename, 1) {
+}
+
+/**
+    * Parameterized constructor that parses the CSV file on several threads.
+    * @param filename The name of the input CSV file containing dish information.
+    * @param thread_count The number of parser threads, capped at the number of hardware
+    * threads; 0 uses one per hardware thread.
+    * @pre The CSV file must be properly formatted.
+    * @post The file is split into newline-aligned chunks that are parsed in parallel.
+    * The dishes are then added in file order with one newOrders call, so the kitchen
+    * ends up exactly as the single-threaded constructor would leave it. Each thread
+    * allocates its dishes in its own arena, and the kitchen adopts those arenas once
+    * the threads are done.*/
+Kitchen::Kitchen(const std::string filename, unsigned int thread_count) : Kitchen() {
+    std::ifstream file(filename, std::ios::binary);
+    std::string buffer;
+    if(file.seekg(0, std::ios::end)){
+        buffer.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0, std::ios::beg);
+        file.read(&buffer[0], buffer.size());
+    }
+    std::string_view text(buffer);
+
+    nextToken(text, '\n'); // skip label line
+
+    // more parsers than hardware threads only adds scheduling overhead
+    unsigned int hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+    if(thread_count == 0 || thread_count > hardware_threads){
+        thread_count = hardware_threads;
+    }
+    // cut the text into roughly equal chunks, moving each cut past the next newline
+    std::vector<std::string_view> chunks;
+    while(chunks.size() + 1 < thread_count && !text.empty()){
+        size_t cut = text.find('\n', text.size() / (thread_count - chunks.size()));
+        cut = (cut == std::string_view::npos) ? text.size() : cut + 1;
+        chunks.push_back(text.substr(0, cut));
+        text.remove_prefix(cut);
+    }
+    chunks.push_back(text);
+
+    std::vector<std::vector<Dish*>> parsed(chunks.size());
+    std::vector<DishArena> arenas(chunks.size());
+    std::vector<std::thread> workers;
+    try{
+        for(size_t i = 1; i < chunks.size(); i++){
+            workers.emplace_back(&Kitchen::parseChunk, this, chunks[i], std::ref(parsed[i]), std::ref(arenas[i]));
         }
-        else if(dishtype == "MAINCOURSE"){
-            adder = parseMainCourse(dishline);
+        parseChunk(chunks[0], parsed[0], arenas[0]);
+    }
+    catch(...){
+        // a joinable std::thread terminates the program when destroyed, finish the started ones first
+        for(std::thread& worker : workers){
+            worker.join();
         }
-        else if(dishtype == "DESSERT"){
-            adder = parseDessert(dishline);
+        throw;
+    }
+    for(std::thread& worker : workers){
+        worker.join();
+    }
+    for(DishArena& arena : arenas){
+        arena_.adopt(arena);
+    }
+
+    size_t total = 0;
+    for(const std::vector<Dish*>& dishes : parsed){
+        total += dishes.size();
+    }
+    std::vector<Dish*> loaded;
+    loaded.reserve(total);
+    for(const std::vector<Dish*>& dishes : parsed){
+        for(Dish* adder : dishes){
+            if(adder == nullptr) exit(1);
+            loaded.push_back(adder);
         }
-        else exit(1);
-        newOrder(adder);
     }
+    newOrders(loaded);
 }
 
 /**
     helper function
-    @param input input from csv string
-    @brief This function's purpose is to turn the string into their matching enum.
-    @return Returns the CuisineType enum
+    @param dishline one csv line, starting with the dish type
+    @param arena where the dish is allocated
+    @brief Dispatches the line to the parser for its dish type.
+    @return Returns the parsed dish, or nullptr if the dish type is unknown
 */
-Dish::CuisineType Kitchen::stringtoCuisine(std::string input){
-    if(input == "ITALIAN"){
-        return Dish::ITALIAN;
+Dish* Kitchen::parseDishLine(std::string_view dishline, DishArena& arena) const{
+    std::string_view dishtype = nextToken(dishline, ','); // APPETIZER, MAIN COURSE, OR DESSERT
+    if(dishtype == "APPETIZER"){
+        return parseAppetizer(dishline, arena);
     }
-    else if(input == "MEXICAN"){
-        return Dish::MEXICAN;
+    else if(dishtype == "MAINCOURSE"){
+        return parseMainCourse(dishline, arena);
     }
-    else if(input == "CHINESE"){
-        return Dish::CHINESE;
+    else if(dishtype == "DESSERT"){
+        return parseDessert(dishline, arena);
     }
-    else if(input == "INDIAN"){
-        return Dish::INDIAN;
-    }
-    else if(input == "AMERICAN"){
-        return Dish::AMERICAN;
-    }
-    else if(input == "FRENCH"){
-        return Dish::FRENCH;
-    }
-    else{
-        return Dish::OTHER;
+    return nullptr;
+}
+
+/**
+    helper function
+    @param chunk whole csv lines
+    @param dishes receives one entry per line, in order
+    @param arena where the dishes are allocated
+    @brief Parses a chunk of the file. Parsing stops after the first line with an
+    unknown dish type, whose nullptr entry tells the caller to bail out.
+*/
+void Kitchen::parseChunk(std::string_view chunk, std::vector<Dish*>& dishes, DishArena& arena) const{
+    while(!chunk.empty()){
+        Dish* adder = parseDishLine(nextToken(chunk, '\n'), arena);
+        dishes.push_back(adder);
+        if(adder == nullptr) return;
     }
 }
 
@@ -207,26 +468,17 @@ Dish::CuisineType Kitchen::stringtoCuisine(std::string input){
     @brief This function's purpose is to parse the line given from the csv and formats into a Appetizer 
     @return Returns the Appetizer dish
 */
-Dish* Kitchen::parseAppetizer(std::string dishline){
-    std::stringstream line(dishline);
-    std::string token, dishtype, name, ingredients, preparationtime, price, cuisinetype, additionalattributes;
-    std::vector<std::string> store;                 ///storing ingredients
-    std::getline(line, name, ',');                  // Name of Dish
-    std::getline(line, ingredients, ',');           // ingredients of the dish
-    std::stringstream ingredientlist(ingredients); 
-    while(std::getline(ingredientlist, token, ';')){ store.push_back(token); } // pushes ingredient list into vector store
-    std::getline(line, preparationtime, ',');       //preptime of the dish
-    std::getline(line, price, ',');                 //price of the dish
-    std::getline(line, cuisinetype, ',');           //the cuisine of the dish
+Dish* Kitchen::parseAppetizer(std::string_view dishline, DishArena& arena) const{
+    std::string_view name = nextToken(dishline, ',');                       // Name of Dish
+    std::vector<Ingredient> store = parseIngredients(nextToken(dishline, ','));  // ingredients of the dish
+    std::string_view preparationtime = nextToken(dishline, ',');            //preptime of the dish
+    std::string_view price = nextToken(dishline, ',');                      //price of the dish
+    std::string_view cuisinetype = nextToken(dishline, ',');                //the cuisine of the dish
 
     // Appetizer Additional Attributes
-    Appetizer::ServingStyle style;
-    std::string spicy;
-    bool vegetarian;
-
-    std::getline(line, additionalattributes, ',');  //additional comments about the dish
-    std::stringstream additionalattributeslist(additionalattributes);
-    std::getline(additionalattributeslist, token, ';');
+    std::string_view additionalattributes = nextToken(dishline, ',');       //additional comments about the dish
+    std::string_view token = nextToken(additionalattributes, ';');
+    Appetizer::ServingStyle style = Appetizer::PLATED;
 
     if(token == "PLATED"){
         style = Appetizer::PLATED;
@@ -238,28 +490,17 @@ Dish* Kitchen::parseAppetizer(std::string dishline){
         style = Appetizer::BUFFET;
     }
 
-    std::getline(additionalattributeslist, token, ';');
-    spicy = token;
+    std::string_view spicy = nextToken(additionalattributes, ';');
+    bool vegetarian = nextToken(additionalattributes, ';') == "true";
 
-    std::getline(additionalattributeslist, token, ';');
-    vegetarian = token == "true";
-    
-    // std::cerr << "Name: " << name << std::endl;
-    // for(std::string x: store){
-    //     std::cerr << "Ingredients: " << x << std::endl;
-    // }
-    // std::cerr << "Preptime: " << preparationtime << std::endl;
-    // std::cerr << "Prince: " << price << std::endl;
-    // std::cerr << "Cuisine: " << cuisinetype << std::endl;
-
-    return new Appetizer(
-        name, 
-        store, 
-        stoi(preparationtime), 
-        stod(price), 
-        stringtoCuisine(cuisinetype),
+    return arena.create<Appetizer>(
+        std::string(name), 
+        std::move(store),
+        toNumber<int>(preparationtime), 
+        toNumber<double>(price), 
+        Dish::stringToCuisine(cuisinetype),
         style,
-        stoi(spicy),
+        toNumber<int>(spicy),
         vegetarian
     );
 }
@@ -270,22 +511,15 @@ Dish* Kitchen::parseAppetizer(std::string dishline){
     @brief This function's purpose is to parse the line given from the csv and formats into a MainCourse 
     @return Returns the MainCourse dish
 */
-Dish* Kitchen::parseMainCourse(std::string dishline){
-    std::stringstream line(dishline);
-    std::string token, dishtype, name, ingredients, preparationtime, price, cuisinetype, additionalattributes;
-    std::vector<std::string> store;                 ///storing ingredients
-    std::getline(line, name, ',');                  // Name of Dish
-    std::getline(line, ingredients, ',');           // ingredients of the dish
-    std::stringstream ingredientlist(ingredients); 
-    while(std::getline(ingredientlist, token, ';')){ store.push_back(token); } // pushes ingredient list into vector store
-    std::getline(line, preparationtime, ',');       //preptime of the dish
-    std::getline(line, price, ',');                 //price of the dish
-    std::getline(line, cuisinetype, ',');           //the cuisine of the dish
+Dish* Kitchen::parseMainCourse(std::string_view dishline, DishArena& arena) const{
+    std::string_view name = nextToken(dishline, ',');                       // Name of Dish
+    std::vector<Ingredient> store = parseIngredients(nextToken(dishline, ','));  // ingredients of the dish
+    std::string_view preparationtime = nextToken(dishline, ',');            //preptime of the dish
+    std::string_view price = nextToken(dishline, ',');                      //price of the dish
+    std::string_view cuisinetype = nextToken(dishline, ',');                //the cuisine of the dish
     
     MainCourse::CookingMethod method;
-    std::string protein;
-
-    std::getline(line, token, ';'); //Cooking Type
+    std::string_view token = nextToken(dishline, ';'); //Cooking Type
 
     if(token == "GRILLED"){
         method = MainCourse::GRILLED;
@@ -309,53 +543,38 @@ Dish* Kitchen::parseMainCourse(std::string dishline){
         method = MainCourse::GRILLED;
     }
 
-    std::getline(line, protein, ';');                   //protein_type
+    std::string_view protein = nextToken(dishline, ';');                    //protein_type
     
     std::vector<MainCourse::SideDish> sidestore;        //sideDish
-
-    std::string sidedishline;
-    std::getline(line, sidedishline, ';');
-    std::stringstream sidedishstream(sidedishline);
-    
-    std::string sidedishname, sidedishcat;
-
+    sidestore.reserve(2);
+    std::string_view sidedishline = nextToken(dishline, ';');
 
     MainCourse::SideDish side1;
-    std::getline(sidedishstream,side1.name,':');
-    std::getline(sidedishstream,sidedishcat,'|');
-    side1.category = stringtoCategory(sidedishcat);
-    sidestore.push_back(side1);
+    side1.name = std::string(nextToken(sidedishline, ':'));
+    side1.category = stringtoCategory(nextToken(sidedishline, '|'));
+    sidestore.push_back(std::move(side1));
 
     MainCourse::SideDish side2;
-    std::getline(sidedishstream,side2.name,':');
-    std::getline(sidedishstream,sidedishcat,';');
-    side2.category = stringtoCategory(sidedishcat);
-    sidestore.push_back(side2);
+    side2.name = std::string(nextToken(sidedishline, ':'));
+    side2.category = stringtoCategory(nextToken(sidedishline, ';'));
+    sidestore.push_back(std::move(side2));
 
-    std::getline(line, token, ','); // Gluten_free
-    
-    // std::cerr << "Name: " << name << std::endl;
-    // for(std::string x: store){
-    //     std::cerr << "Ingredients: " << x << std::endl;
-    // }
-    // std::cerr << "Preptime: " << preparationtime << std::endl;
-    // std::cerr << "Prince: " << price << std::endl;
-    // std::cerr << "Cuisine: " << cuisinetype << std::endl;
-
-    return new MainCourse(
-        name,
-        store,
-        stoi(preparationtime), 
-        stod(price),
-        stringtoCuisine(cuisinetype),
+    token = nextToken(dishline, ','); // Gluten_free
+
+    return arena.create<MainCourse>(
+        std::string(name),
+        std::move(store),
+        toNumber<int>(preparationtime), 
+        toNumber<double>(price),
+        Dish::stringToCuisine(cuisinetype),
         method,
-        protein,
-        sidestore,
+        std::string(protein),
+        std::move(sidestore),
         token == "true"
     );
 }
 
-MainCourse::Category Kitchen::stringtoCategory(std::string cat){
+MainCourse::Category Kitchen::stringtoCategory(std::string_view cat) const{
     if(cat == "GRAIN"){
         return MainCourse::Category::GRAIN;
     }
@@ -391,26 +610,17 @@ MainCourse::Category Kitchen::stringtoCategory(std::string cat){
     @brief This function's purpose is to parse the line given from the csv and formats into a Dessert 
     @return Returns the Dessert dish
 */
-Dish* Kitchen::parseDessert(std::string dishline){
-    std::stringstream line(dishline);
-    std::string token, dishtype, name, ingredients, preparationtime, price, cuisinetype, additionalattributes;
-    std::vector<std::string> store;                 ///storing ingredients
-    std::getline(line, name, ',');                  // Name of Dish
-    std::getline(line, ingredients, ',');           // ingredients of the dish
-    std::stringstream ingredientlist(ingredients); 
-    while(std::getline(ingredientlist, token, ';')){ store.push_back(token); } // pushes ingredient list into vector store
-    std::getline(line, preparationtime, ',');       //preptime of the dish
-    std::getline(line, price, ',');                 //price of the dish
-    std::getline(line, cuisinetype, ',');           //the cuisine of the dish
+Dish* Kitchen::parseDessert(std::string_view dishline, DishArena& arena) const{
+    std::string_view name = nextToken(dishline, ',');                       // Name of Dish
+    std::vector<Ingredient> store = parseIngredients(nextToken(dishline, ','));  // ingredients of the dish
+    std::string_view preparationtime = nextToken(dishline, ',');            //preptime of the dish
+    std::string_view price = nextToken(dishline, ',');                      //price of the dish
+    std::string_view cuisinetype = nextToken(dishline, ',');                //the cuisine of the dish
     
     //Dessert Additional Attributes
-    Dessert::FlavorProfile profile;
-    std::string sweet;
-    std::string nuts; 
-    
-    std::getline(line, additionalattributes, ',');  //additional comments about the dish
-    std::stringstream additionalattributeslist(additionalattributes);
-    std::getline(additionalattributeslist, token, ';'); // first token: Flavor Profile
+    std::string_view additionalattributes = nextToken(dishline, ',');       //additional comments about the dish
+    std::string_view token = nextToken(additionalattributes, ';');      // first token: Flavor Profile
+    Dessert::FlavorProfile profile = Dessert::SWEET;
 
     if(token == "SWEET"){
         profile = Dessert::SWEET;
@@ -428,37 +638,416 @@ Dish* Kitchen::parseDessert(std::string dishline){
         profile = Dessert::UMAMI;
     }
 
-    std::getline(additionalattributeslist, sweet, ';');
-    std::getline(additionalattributeslist, nuts, ';');
-    
-    // std::cerr << "Name: " << name << std::endl;
-    // for(std::string x: store){
-    //     std::cerr << "Ingredients: " << x << std::endl;
-    // }
-    // std::cerr << "Preptime: " << preparationtime << std::endl;
-    // std::cerr << "Prince: " << price << std::endl;
-    // std::cerr << "Cuisine: " << cuisinetype << std::endl;
-
-    return new Dessert(
-        name,
-        store,
-        stoi(preparationtime), 
-        stod(price),
-        stringtoCuisine(cuisinetype), 
+    std::string_view sweet = nextToken(additionalattributes, ';');
+    std::string_view nuts = nextToken(additionalattributes, ';');
+
+    return arena.create<Dessert>(
+        std::string(name),
+        std::move(store),
+        toNumber<int>(preparationtime), 
+        toNumber<double>(price),
+        Dish::stringToCuisine(cuisinetype), 
         profile,
-        stoi(sweet),
+        toNumber<int>(sweet),
         nuts == "true"
     );
 }
 
+/**
+    helper function
+    @param dish an open order
+    @return Returns true if the dish has 5 or more ingredients AND takes an hour or more to prepare
+*/
+bool Kitchen::isElaborate(const Dish* dish){
+    return KitchenStats::isElaborate(static_cast<int>(dish->ingredientCount()), dish->getPrepTime());
+}
+
+/**
+    helper function
+    @param dish any dish
+    @return Returns the DishTag of the dish's concrete type
+*/
+Kitchen::DishTag Kitchen::dishTagOf(const Dish* dish){
+    if(dynamic_cast<const Appetizer*>(dish)) return APPETIZER_TAG;
+    if(dynamic_cast<const MainCourse*>(dish)) return MAINCOURSE_TAG;
+    if(dynamic_cast<const Dessert*>(dish)) return DESSERT_TAG;
+    return OTHER_TAG;
+}
+
+// Columnar mirror
+/**
+    * Turns the structure-of-arrays mirror of the open orders on or off.
+    * @param enabled True to build the columns from the current orders and keep them
+    * in step from now on, false to drop them.
+    * @post While enabled, newOrder(s), serveDish, releaseIf and dietaryAdjustment keep
+    * getColumns() matching the bag position for position, and getStats reads the
+    * columns instead of following every Dish pointer.*/
+void Kitchen::setColumnarMirror(bool enabled){
+    columnar_ = enabled;
+    if(columnar_){
+        rebuildColumns();
+    }
+    else{
+        columns_ = OrderColumns();
+    }
+}
+
+/**
+    * @return True if the columnar mirror is maintained, false otherwise.*/
+bool Kitchen::hasColumnarMirror() const{
+    return columnar_;
+}
+
+/**
+    * @return The columnar mirror; its columns are empty while the mirror is off.*/
+const Kitchen::OrderColumns& Kitchen::getColumns() const{
+    return columns_;
+}
+
+/**
+    helper function
+    @param dish the order just added at the end of items_
+    @post Appends the dish's fields to every column
+*/
+void Kitchen::appendColumns(const Dish* dish){
+    columns_.prep_times.push_back(dish->getPrepTime());
+    columns_.prices.push_back(dish->getPrice());
+    columns_.cuisines.push_back(dish->getCuisineEnum());
+    columns_.ingredient_counts.push_back(static_cast<int>(dish->ingredientCount()));
+    columns_.dish_tags.push_back(dishTagOf(dish));
+}
+
+/**
+    helper function
+    @post Refills every column from items_
+*/
+void Kitchen::rebuildColumns(){
+    columns_ = OrderColumns();
+    columns_.prep_times.reserve(item_count_);
+    columns_.prices.reserve(item_count_);
+    columns_.cuisines.reserve(item_count_);
+    columns_.ingredient_counts.reserve(item_count_);
+    columns_.dish_tags.reserve(item_count_);
+    for(int i = 0; i < item_count_; i++){
+        appendColumns(items_[i]);
+    }
+}
+
+// Binary snapshots
+namespace {
+const char SNAPSHOT_MAGIC[4] = {'K', 'S', 'N', 'P'};
+const uint32_t SNAPSHOT_VERSION = 1;
+
+/**
+    helper function
+    @brief Appends the raw bytes of a fixed-size value to out.
+*/
+template<class T>
+void writeValue(std::string& out, const T& value){
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+    helper class
+    @brief Assigns each distinct string a dense id, in first-seen order.
+*/
+class StringInterner{
+    public:
+        uint32_t intern(const std::string& s){
+            std::unordered_map<std::string, uint32_t>::iterator it = ids_.find(s);
+            if(it != ids_.end()) return it->second;
+            uint32_t id = static_cast<uint32_t>(strings_.size());
+            ids_.emplace(s, id);
+            strings_.push_back(&ids_.find(s)->first);
+            return id;
+        }
+        const std::vector<const std::string*>& strings() const { return strings_; }
+    private:
+        std::unordered_map<std::string, uint32_t> ids_;
+        std::vector<const std::string*> strings_; // point into ids_, whose keys never move
+};
+
+/**
+    helper class
+    @brief Bounds-checked reader over a snapshot buffer. Every read returns false
+    instead of running past the end, so a truncated file is simply rejected.
+*/
+class SnapshotReader{
+    public:
+        explicit SnapshotReader(std::string_view data) : data_(data) {}
+        template<class T>
+        bool read(T& value){
+            if(data_.size() < sizeof(T)) return false;
+            std::memcpy(&value, data_.data(), sizeof(T));
+            data_.remove_prefix(sizeof(T));
+            return true;
+        }
+        bool readString(std::string& value){
+            uint32_t length;
+            if(!read(length) || data_.size() < length) return false;
+            value.assign(data_.data(), length);
+            data_.remove_prefix(length);
+            return true;
+        }
+        bool readId(uint32_t& id, const std::vector<std::string>& strings){
+            return read(id) && id < strings.size();
+        }
+        bool atEnd() const { return data_.empty(); }
+        size_t remaining() const { return data_.size(); }
+    private:
+        std::string_view data_;
+};
+} // namespace
+
+/**
+    * Writes the open orders and running counters to a binary snapshot.
+    * @param filename The file to create or overwrite.
+    * @post The file holds, in native byte order: the magic "KSNP" and a format
+    * version, a table of every distinct string (names, ingredients, proteins,
+    * side dishes), one record per dish that refers to strings by table index,
+    * then total_prep_time_ and count_elaborate_.
+    * @return True if the snapshot was written, false if the file could not be
+    * written or holds a dish that is not an Appetizer, MainCourse or Dessert.*/
+bool Kitchen::saveSnapshot(const std::string& filename) const{
+    StringInterner strings;
+    std::string records;
+    writeValue(records, static_cast<uint32_t>(item_count_));
+    for(int i = 0; i < item_count_; i++){
+        const Dish* dish = items_[i];
+        DishTag tag = dishTagOf(dish);
+        if(tag == OTHER_TAG) return false;
+        writeValue(records, static_cast<uint8_t>(tag));
+        const Appetizer* appetizer = tag == APPETIZER_TAG ? static_cast<const Appetizer*>(dish) : nullptr;
+        const MainCourse* main_course = tag == MAINCOURSE_TAG ? static_cast<const MainCourse*>(dish) : nullptr;
+        const Dessert* dessert = tag == DESSERT_TAG ? static_cast<const Dessert*>(dish) : nullptr;
+
+        writeValue(records, strings.intern(dish->getName()));
+        writeValue(records, static_cast<int32_t>(dish->getPrepTime()));
+        writeValue(records, dish->getPrice());
+        writeValue(records, static_cast<uint8_t>(dish->getCuisineEnum()));
+        const std::vector<Ingredient>& ingredients = dish->getIngredients();
+        writeValue(records, static_cast<uint32_t>(ingredients.size()));
+        for(const Ingredient& ingredient : ingredients){
+            writeValue(records, strings.intern(ingredient.getName()));
+            writeValue(records, static_cast<int32_t>(ingredient.quantity));
+            writeValue(records, static_cast<int32_t>(ingredient.required_quantity));
+            writeValue(records, ingredient.price);
+        }
+
+        if(appetizer){
+            writeValue(records, static_cast<uint8_t>(appetizer->getServingStyle()));
+            writeValue(records, static_cast<int32_t>(appetizer->getSpicinessLevel()));
+            writeValue(records, static_cast<uint8_t>(appetizer->isVegetarian()));
+        }
+        else if(main_course){
+            writeValue(records, static_cast<uint8_t>(main_course->getCookingMethod()));
+            writeValue(records, strings.intern(main_course->getProteinType()));
+            const std::vector<MainCourse::SideDish>& sides = main_course->getSideDishes();
+            writeValue(records, static_cast<uint32_t>(sides.size()));
+            for(const MainCourse::SideDish& side : sides){
+                writeValue(records, strings.intern(side.name));
+                writeValue(records, static_cast<uint8_t>(side.category));
+            }
+            writeValue(records, static_cast<uint8_t>(main_course->isGlutenFree()));
+        }
+        else{
+            writeValue(records, static_cast<uint8_t>(dessert->getFlavorProfile()));
+            writeValue(records, static_cast<int32_t>(dessert->getSweetnessLevel()));
+            writeValue(records, static_cast<uint8_t>(dessert->containsNuts()));
+        }
+    }
+    writeValue(records, static_cast<int32_t>(total_prep_time_));
+    writeValue(records, static_cast<int32_t>(count_elaborate_));
+
+    std::string header(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    writeValue(header, SNAPSHOT_VERSION);
+    writeValue(header, static_cast<uint32_t>(strings.strings().size()));
+    for(const std::string* s : strings.strings()){
+        writeValue(header, static_cast<uint32_t>(s->size()));
+        header += *s;
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file.write(header.data(), header.size());
+    file.write(records.data(), records.size());
+    return static_cast<bool>(file);
+}
+
+/**
+    * Replaces the open orders with the contents of a snapshot written by saveSnapshot.
+    * @param filename The snapshot file.
+    * @post On success the kitchen holds the snapshot's dishes in their saved order
+    * and the running counters match the saved ones. The previous orders are
+    * dropped and every dish the kitchen had created so far is freed.
+    * @return True if the snapshot was restored. False if the file is missing,
+    * truncated, has another format version, holds an enum value out of range, or
+    * its counters do not match its dishes; the kitchen is left untouched in that case.*/
+bool Kitchen::loadSnapshot(const std::string& filename){
+    std::ifstream file(filename, std::ios::binary);
+    std::string buffer;
+    if(!file.seekg(0, std::ios::end)) return false;
+    buffer.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0, std::ios::beg);
+    file.read(&buffer[0], buffer.size());
+    if(!file) return false;
+
+    SnapshotReader reader(buffer);
+    char magic[sizeof(SNAPSHOT_MAGIC)];
+    uint32_t version, string_count;
+    if(!reader.read(magic) || std::memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) != 0) return false;
+    if(!reader.read(version) || version != SNAPSHOT_VERSION) return false;
+    // every string takes at least its length prefix, so a larger count is corrupt
+    if(!reader.read(string_count) || string_count > reader.remaining() / sizeof(uint32_t)) return false;
+    std::vector<std::string> strings(string_count);
+    for(std::string& s : strings){
+        if(!reader.readString(s)) return false;
+    }
+
+    uint32_t dish_count;
+    if(!reader.read(dish_count)) return false;
+    DishArena loaded;
+    std::vector<Dish*> dishes;
+    bool ok = true;
+    for(uint32_t d = 0; ok && d < dish_count; d++){
+        uint8_t tag, cuisine;
+        uint32_t name_id, ingredient_count;
+        int32_t prep_time;
+        double price;
+        ok = reader.read(tag) && reader.readId(name_id, strings) && reader.read(prep_time)
+            && reader.read(price) && reader.read(cuisine) && cuisine < CUISINE_TYPE_COUNT
+            && reader.read(ingredient_count);
+        std::vector<Ingredient> ingredients;
+        for(uint32_t i = 0; ok && i < ingredient_count; i++){
+            uint32_t ingredient_id;
+            int32_t quantity, required_quantity;
+            double ingredient_price;
+            ok = reader.readId(ingredient_id, strings) && reader.read(quantity)
+                && reader.read(required_quantity) && reader.read(ingredient_price);
+            if(ok) ingredients.emplace_back(strings[ingredient_id], quantity, required_quantity, ingredient_price);
+        }
+        if(!ok) break;
+
+        Dish::CuisineType cuisine_type = static_cast<Dish::CuisineType>(cuisine);
+        if(tag == APPETIZER_TAG){
+            uint8_t style, vegetarian;
+            int32_t spiciness;
+            ok = reader.read(style) && style <= Appetizer::BUFFET && reader.read(spiciness) && reader.read(vegetarian);
+            if(ok) dishes.push_back(loaded.create<Appetizer>(strings[name_id], std::move(ingredients), prep_time, price, cuisine_type,
+                static_cast<Appetizer::ServingStyle>(style), spiciness, vegetarian != 0));
+        }
+        else if(tag == MAINCOURSE_TAG){
+            uint8_t method, gluten_free;
+            uint32_t protein_id, side_count;
+            ok = reader.read(method) && method <= MainCourse::RAW && reader.readId(protein_id, strings) && reader.read(side_count);
+            std::vector<MainCourse::SideDish> sides;
+            for(uint32_t i = 0; ok && i < side_count; i++){
+                uint32_t side_id;
+                uint8_t category;
+                ok = reader.readId(side_id, strings) && reader.read(category) && category <= MainCourse::VEGETABLE;
+                if(ok) sides.push_back({strings[side_id], static_cast<MainCourse::Category>(category)});
+            }
+            ok = ok && reader.read(gluten_free);
+            if(ok) dishes.push_back(loaded.create<MainCourse>(strings[name_id], std::move(ingredients), prep_time, price, cuisine_type,
+                static_cast<MainCourse::CookingMethod>(method), strings[protein_id], std::move(sides), gluten_free != 0));
+        }
+        else if(tag == DESSERT_TAG){
+            uint8_t profile, nuts;
+            int32_t sweetness;
+            ok = reader.read(profile) && profile <= Dessert::UMAMI && reader.read(sweetness) && reader.read(nuts);
+            if(ok) dishes.push_back(loaded.create<Dessert>(strings[name_id], std::move(ingredients), prep_time, price, cuisine_type,
+                static_cast<Dessert::FlavorProfile>(profile), sweetness, nuts != 0));
+        }
+        else{
+            ok = false;
+        }
+    }
+
+    // the saved counters must agree with the saved dishes
+    int32_t saved_prep_time, saved_elaborate;
+    ok = ok && reader.read(saved_prep_time) && reader.read(saved_elaborate) && reader.atEnd();
+    int prep_time_sum = 0, elaborate = 0;
+    for(const Dish* dish : dishes){
+        prep_time_sum += dish->getPrepTime();
+        elaborate += isElaborate(dish) ? 1 : 0;
+    }
+    if(!ok || prep_time_sum != saved_prep_time || elaborate != saved_elaborate){
+        return false;
+    }
+
+    clear();
+    arena_.release();
+    arena_.adopt(loaded);
+    newOrders(dishes);
+    return true;
+}
+
 /**
     * Adjusts all dishes in the kitchen based on the specified dietary accommodation.
     * @param request A DietaryRequest structure specifying the dietary accommodations.
-    * @post Calls the `dietaryAccommodations()` method on each dish in the kitchen to adjust them accordingly.*/
+    * @post Calls the `dietaryAccommodations()` method on each dish in the kitchen to adjust them accordingly.
+    * Adjustments can drop ingredients, so the elaborate count (and the ingredient
+    * column of the columnar mirror) is refreshed afterwards.*/
 void Kitchen::dietaryAdjustment(const Dish::DietaryRequest& request){
-    for(int i = 0; i < item_count_; i++){
+    dietaryAdjustment(request, 1);
+}
+
+/**
+    * Adjusts all dishes in the kitchen on several threads.
+    * @param request A DietaryRequest structure specifying the dietary accommodations.
+    * @param thread_count The number of threads, capped at the number of hardware
+    * threads; 0 uses one per hardware thread.
+    * @post Same final state as the single-threaded dietaryAdjustment. The orders are
+    * split into contiguous chunks; each dish is touched by exactly one thread, and the
+    * per-chunk elaborate counts are summed once all threads are done.*/
+void Kitchen::dietaryAdjustment(const Dish::DietaryRequest& request, unsigned int thread_count){
+    unsigned int hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+    if(thread_count == 0 || thread_count > hardware_threads){
+        thread_count = hardware_threads;
+    }
+    int chunk_count = std::max(1, std::min(static_cast<int>(thread_count), item_count_));
+    std::vector<int> elaborate(chunk_count, 0);
+    std::vector<std::thread> workers;
+    try{
+        for(int c = 1; c < chunk_count; c++){
+            workers.emplace_back([this, &request, &elaborate, c, chunk_count]() {
+                elaborate[c] = adjustRange(request, item_count_ * c / chunk_count, item_count_ * (c + 1) / chunk_count);
+            });
+        }
+        elaborate[0] = adjustRange(request, 0, item_count_ / chunk_count);
+    }
+    catch(...){
+        // same as the loader: never destroy a joinable std::thread
+        for(std::thread& worker : workers){
+            worker.join();
+        }
+        throw;
+    }
+    for(std::thread& worker : workers){
+        worker.join();
+    }
+    count_elaborate_ = std::accumulate(elaborate.begin(), elaborate.end(), 0);
+}
+
+/**
+    helper function
+    @param request the dietary request to apply
+    @param begin first position in items_ to adjust
+    @param end one past the last position to adjust
+    @post Adjusts items_[begin, end) and refreshes their ingredient column entries
+    @return The number of elaborate dishes in the range after the adjustment
+*/
+int Kitchen::adjustRange(const Dish::DietaryRequest& request, int begin, int end){
+    int elaborate = 0;
+    for(int i = begin; i < end; i++){
         items_[i]->dietaryAccommodations(request);
+        if(isElaborate(items_[i])){
+            elaborate++;
+        }
+        if(columnar_){
+            columns_.ingredient_counts[i] = static_cast<int>(items_[i]->ingredientCount());
+        }
     }
+    return elaborate;
 }
 
 /**
@@ -472,10 +1061,10 @@ void Kitchen::displayMenu() const{
 
 /**
     * Destructor.
-    * @post Deallocates all dynamically allocated dishes to prevent memory leaks.*/
+    * @post Deallocates all dynamically allocated dishes to prevent memory leaks.
+    * Dishes the kitchen created (CSV and snapshot loads) live in arena_ and are
+    * freed together; dishes passed in through newOrder belong to the caller.*/
 Kitchen::~Kitchen() {
-    // while(!isEmpty()) {
-    //     delete items_[0];
-    // }
     clear();
+    arena_.release();
 }
\ No newline at end of file
@@ -2,44 +2,103 @@
 #define KITCHEN_HPP
 #include <string>
 #include <cmath>
+#include <algorithm>
+#include <numeric>
 #include <fstream>
 #include <sstream>
+#include <string_view>
+#include <charconv>
+#include <cctype>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
 
 #include "ArrayBag.hpp"
+#include "DishArena.hpp"
 #include "Dish.hpp"
 #include "MainCourse.hpp"
 #include "Appetizer.hpp"
 #include "Dessert.hpp"
+#include "KitchenStats.hpp"
 
 class Kitchen : public ArrayBag<Dish*> {
     public:
+        static const int CUISINE_TYPE_COUNT = Dish::CUISINE_TYPE_COUNT;
+
+        /**
+         * Concrete type of a dish, as stored in snapshots and in the columnar mirror.
+         */
+        enum DishTag : uint8_t { APPETIZER_TAG, MAINCOURSE_TAG, DESSERT_TAG, OTHER_TAG };
+
+        /**
+         * Structure-of-arrays copy of the fields the statistics read. Entry i of
+         * every column describes items_[i].
+         */
+        struct OrderColumns {
+            std::vector<int> prep_times;
+            std::vector<double> prices;
+            std::vector<uint8_t> cuisines;          // Dish::CuisineType
+            std::vector<int> ingredient_counts;
+            std::vector<uint8_t> dish_tags;         // DishTag
+        };
+
+        // Snapshot of the aggregate statistics over the open orders, see KitchenStats.hpp
+        using KitchenStats = ::KitchenStats;
+
         Kitchen();
         bool newOrder(Dish* new_dish);
+        int newOrders(const std::vector<Dish*>& new_dishes);
         bool serveDish(Dish* dish_to_remove);
+        void clear();
         int getPrepTimeSum() const;
         int calculateAvgPrepTime() const;
         int elaborateDishCount() const;
         double calculateElaboratePercentage() const;
         int tallyCuisineTypes(const std::string& cuisine_type) const;
+        int tallyCuisineTypes(Dish::CuisineType cuisine_type) const;
         int releaseDishesBelowPrepTime(const int& prep_time);
         int releaseDishesOfCuisineType(const std::string& cuisine_type);
+        int releaseDishesOfCuisineType(Dish::CuisineType cuisine_type);
+        std::vector<Dish*> releaseIf(const std::function<bool(const Dish*)>& predicate);
         void kitchenReport() const;
+        KitchenStats getStats() const;
         Kitchen(const std::string);
+        Kitchen(const std::string filename, unsigned int thread_count);
         //project 4
         //Kitchen(const std::string filename);
         void dietaryAdjustment(const Dish::DietaryRequest&);
+        void dietaryAdjustment(const Dish::DietaryRequest&, unsigned int thread_count);
         void displayMenu() const;
+        bool saveSnapshot(const std::string& filename) const;
+        bool loadSnapshot(const std::string& filename);
+        void setColumnarMirror(bool enabled);
+        bool hasColumnarMirror() const;
+        const OrderColumns& getColumns() const;
         ~Kitchen();
+        // true if the dish has 5 or more ingredients AND takes an hour or more to prepare
+        static bool isElaborate(const Dish*);
 
     private:
         int total_prep_time_;
         int count_elaborate_;
+        int cuisine_counts_[CUISINE_TYPE_COUNT]; // open orders per Dish::CuisineType
+        DishArena arena_;                        // owns every dish the kitchen creates itself
+        bool columnar_;                          // keep columns_ in step with items_
+        OrderColumns columns_;
         //helper functions
-        Dish::CuisineType stringtoCuisine(std::string);
-        Dish* parseAppetizer(std::string);
-        Dish* parseMainCourse(std::string);
-        Dish* parseDessert(std::string);
-        MainCourse::Category stringtoCategory(std::string cat);
+        static DishTag dishTagOf(const Dish*);
+        void appendColumns(const Dish*);
+        void rebuildColumns();
+        int adjustRange(const Dish::DietaryRequest&, int begin, int end);
+        Dish* parseDishLine(std::string_view, DishArena&) const;
+        void parseChunk(std::string_view, std::vector<Dish*>&, DishArena&) const;
+        Dish* parseAppetizer(std::string_view, DishArena&) const;
+        Dish* parseMainCourse(std::string_view, DishArena&) const;
+        Dish* parseDessert(std::string_view, DishArena&) const;
+        MainCourse::Category stringtoCategory(std::string_view cat) const;
 
 };
 #endif // KITCHEN_HPP
\ No newline at end of file
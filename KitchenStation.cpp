@@ -1,11 +1,11 @@
 #include "KitchenStation.hpp"
 
 KitchenStation::KitchenStation() 
-    : station_name_("UNKNOWN"), dishes_({}), ingredients_stock_({}) {
+    : station_name_("UNKNOWN"), dishes_({}), dish_index_(), ingredients_stock_({}), stock_index_(), thread_safe_(false) {
 }
 
 KitchenStation::KitchenStation(const std::string& station_name) 
-    : station_name_(station_name), dishes_({}), ingredients_stock_({}) {
+    : station_name_(station_name), dishes_({}), dish_index_(), ingredients_stock_({}), stock_index_(), thread_safe_(false) {
 }
 
 KitchenStation::~KitchenStation() {
@@ -23,11 +23,14 @@ void KitchenStation::setName(const std::string& station_name) {
 // get dishes
 std::vector<Dish*> KitchenStation::getDishes() const
 {
+    std::shared_lock<std::shared_mutex> structure = sharedLock();
     return dishes_;
 }
 // get ingredients stock
 std::vector<Ingredient> KitchenStation::getIngredientsStock() const
 {
+    // exclusive, so no quantity is being updated while copying
+    std::unique_lock<std::shared_mutex> structure = exclusiveLock();
     return ingredients_stock_;
 }
 
@@ -35,7 +38,8 @@ bool KitchenStation::assignDishToStation(Dish* dish) {
     if (dish == nullptr) {
         return false;
     }
-    if (isPresent(dish->getName())) {
+    std::unique_lock<std::shared_mutex> structure = exclusiveLock();
+    if (!dish_index_.emplace(dish->getName(), dish).second) {
         return false;
     }
     else {  
@@ -44,114 +48,212 @@ bool KitchenStation::assignDishToStation(Dish* dish) {
     }
 }
 
-bool KitchenStation::isPresent(const std::string& dish_name) const {
-    for (Dish* dish : dishes_) {
-        if (dish->getName() == dish_name) {
-            return true;
-        }
-    }
-    return false;
+Dish* KitchenStation::findDish(const std::string& dish_name) const {
+    std::unordered_map<std::string, Dish*>::const_iterator it = dish_index_.find(dish_name);
+    return it == dish_index_.end() ? nullptr : it->second;
 }
 
 void KitchenStation::replenishStationIngredients(const Ingredient& ingredient) {
     //check if ingredient is already in stock
-    for (Ingredient& stock_ingredient : ingredients_stock_) {
-        if (stock_ingredient.name == ingredient.name) {
-            // std::cout<< "Found ingredient "<< stock_ingredient.name << std::endl;
-            // std::cout<< "We have "<< stock_ingredient.quantity << " of "<< stock_ingredient.name << std::endl;
-            // std::cout<< "We are adding "<< ingredient.quantity << " of "<< ingredient.name << std::endl;
-            stock_ingredient.quantity += ingredient.quantity;
-            // std::cout<< "We now have "<< stock_ingredient.quantity << " of "<< stock_ingredient.name << std::endl;
+    int ingredient_id = ingredient.getId();
+    {
+        std::shared_lock<std::shared_mutex> structure = sharedLock();
+        int position = findStock(ingredient_id);
+        if (position >= 0) {
+            StripeGuard stripe(*this, {{position, 0}});
+            ingredients_stock_[position].quantity += ingredient.quantity;
             return;
         }
     }
+    std::unique_lock<std::shared_mutex> structure = exclusiveLock();
+    int position = findStock(ingredient_id);
+    if (position >= 0) { // another thread added it in between
+        ingredients_stock_[position].quantity += ingredient.quantity;
+        return;
+    }
+    stock_index_[ingredient_id] = static_cast<int>(ingredients_stock_.size());
     ingredients_stock_.push_back(ingredient);
 }
 
 bool KitchenStation::canCompleteOrder(const std::string& dish_name) const {
-    for (Dish* dish : dishes_) {
-        // std::cout<< "Dish name: "<< dish->getName()<<std::endl;
-        if (dish->getName() == dish_name) {
-            // std::cout << "Checking if we can complete order for " << dish_name << std::endl;
-            for (Ingredient ingredient : dish->getIngredients()) {
-                // std::cout << "Checking for ingredient " << ingredient.name << std::endl;
-                bool found = false;
-                for (Ingredient stock_ingredient : ingredients_stock_) {
-                    if (stock_ingredient.name == ingredient.name) {
-                        // std::cout<< "Found ingredient "<< stock_ingredient.name << " and we have "<< stock_ingredient.quantity << std::endl;
-                        if (stock_ingredient.quantity >= ingredient.required_quantity) {
-                            // std::cout<<"YAY We need "<< ingredient.required_quantity << " of "<< ingredient.name << " and we have "<< stock_ingredient.quantity << std::endl;
-                            // std::cout << "Found enough quantity of " << stock_ingredient.name << std::endl;
-                            found = true;
-                        }
-                        else {
-                            // std::cout << "Did not find enough quantity of " << stock_ingredient.name << std::endl;
-                            // std::cout<<"NO We need "<< ingredient.required_quantity << " of "<< ingredient.name << " and we have "<< stock_ingredient.quantity << std::endl;
-                            return false;
-                        }
-                    }
-                }
-                if (!found) {
-                    // std::cout<< "Did not find " << ingredient.name << std::endl;
-                    return false;
-                }
-            }
-            return true;
-        }
+    std::shared_lock<std::shared_mutex> structure = sharedLock();
+    Dish* dish = findDish(dish_name);
+    std::vector<std::pair<int, int>> requirements;
+    if (dish == nullptr || !resolveRequirements(dish, requirements)) {
+        return false;
     }
-    return false;
+    StripeGuard stripes(*this, requirements);
+    return portionsInStock(requirements) >= 1;
 }
 
 bool KitchenStation::prepareDish(const std::string& dish_name) {
-    if (!canCompleteOrder(dish_name)) {
+    return prepareDishes(dish_name, 1);
+}
+
+bool KitchenStation::prepareDishes(const std::string& dish_name, int count) {
+    if (count < 1) {
         return false;
     }
-    else{
-        //std::cout<< "Preparing dish: "<< dish_name << std::endl;
-    }
-    for (Dish* dish : dishes_) {
-        if (dish->getName() == dish_name) {
-            // Check if we have all the ingredients and the right quantity before doing anything else
-            for (Ingredient ingredient : dish->getIngredients()) {
-                bool found = false;
-                for (Ingredient& stock_ingredient : ingredients_stock_) {
-                    if (stock_ingredient.name == ingredient.name) {
-                        // Check if we have enough stock
-                        if (stock_ingredient.quantity >= ingredient.quantity) {
-                            found = true;
-                            break; // breaks out of the inner loop, so we check the next ingredient
-                        }
-                    }
-                }
-                if (!found) { // one of the ingredients is missing or not enough
-                    return false;
-                }
-                // If we reach this point, we have all the ingredients in stock. Hooray!
-            }
-            // Deduct the ingredients from stock
-            for (Ingredient ingredient : dish->getIngredients()) {
-                for (Ingredient& stock_ingredient : ingredients_stock_) {
-                    if (stock_ingredient.name == ingredient.name) {
-                        stock_ingredient.quantity -= ingredient.required_quantity;
-                        // if we have 0 quantity of an ingredient, we should remove it from stock
-                        if (stock_ingredient.quantity == 0) {
-                            removeIngredient(stock_ingredient.name);
-                        }
-                    }
-                }
+    std::vector<int> emptied;
+    {
+        std::shared_lock<std::shared_mutex> structure = sharedLock();
+        Dish* dish = findDish(dish_name);
+        std::vector<std::pair<int, int>> requirements;
+        if (dish == nullptr || !resolveRequirements(dish, requirements)) {
+            return false;
+        }
+        // Check every ingredient before touching the stock, so a failed order changes nothing
+        StripeGuard stripes(*this, requirements);
+        if (portionsInStock(requirements) < count) {
+            return false;
+        }
+        // Deduct the ingredients for all portions at once
+        for (const std::pair<int, int>& requirement : requirements) {
+            Ingredient& stock_ingredient = ingredients_stock_[requirement.first];
+            stock_ingredient.quantity -= requirement.second * count;
+            if (stock_ingredient.quantity == 0) {
+                emptied.push_back(stock_ingredient.getId());
             }
-            return true;
         }
     }
-    return false; 
+    // if we have 0 quantity of an ingredient, we should remove it from stock
+    removeEmptied(emptied);
+    return true;
+}
+
+int KitchenStation::maxPreparable(const std::string& dish_name) const {
+    std::shared_lock<std::shared_mutex> structure = sharedLock();
+    Dish* dish = findDish(dish_name);
+    std::vector<std::pair<int, int>> requirements;
+    if (dish == nullptr || !resolveRequirements(dish, requirements)) {
+        return 0;
+    }
+    StripeGuard stripes(*this, requirements);
+    return portionsInStock(requirements);
 }
 
 bool KitchenStation::removeIngredient(const std::string& ingredient_name) {
-    for (size_t i = 0; i < ingredients_stock_.size(); i++) {
-        if (ingredients_stock_[i].name == ingredient_name) {
-            ingredients_stock_.erase(ingredients_stock_.begin() + i);
-            return true;
+    int ingredient_id = IngredientTable::find(ingredient_name);
+    if (ingredient_id == IngredientTable::NOT_FOUND) {
+        return false;
+    }
+    std::unique_lock<std::shared_mutex> structure = exclusiveLock();
+    int position = findStock(ingredient_id);
+    if (position < 0) {
+        return false;
+    }
+    eraseStock(position);
+    return true;
+}
+
+void KitchenStation::setThreadSafe(bool enabled) {
+    thread_safe_ = enabled;
+}
+
+bool KitchenStation::isThreadSafe() const {
+    return thread_safe_;
+}
+
+bool KitchenStation::resolveRequirements(const Dish* dish, std::vector<std::pair<int, int>>& requirements) const {
+    const std::vector<Ingredient>& ingredients = dish->getIngredients();
+    requirements.clear();
+    requirements.reserve(ingredients.size());
+    for (const Ingredient& ingredient : ingredients) {
+        int position = findStock(ingredient.getId());
+        if (position < 0) {
+            return false;
+        }
+        requirements.emplace_back(position, ingredient.required_quantity);
+    }
+    // a dish can list the same ingredient twice, merge those lines into one requirement
+    std::sort(requirements.begin(), requirements.end());
+    size_t merged = 0;
+    for (size_t i = 0; i < requirements.size(); i++) {
+        if (merged > 0 && requirements[merged - 1].first == requirements[i].first) {
+            requirements[merged - 1].second += requirements[i].second;
         }
+        else {
+            requirements[merged++] = requirements[i];
+        }
+    }
+    requirements.resize(merged);
+    return true;
+}
+
+int KitchenStation::portionsInStock(const std::vector<std::pair<int, int>>& requirements) const {
+    int portions = std::numeric_limits<int>::max();
+    for (const std::pair<int, int>& requirement : requirements) {
+        int in_stock = ingredients_stock_[requirement.first].quantity;
+        if (requirement.second > 0) {
+            portions = std::min(portions, std::max(in_stock, 0) / requirement.second);
+        }
+        else if (in_stock < requirement.second) {
+            return 0; // stock already below a zero (or negative) requirement
+        }
+    }
+    return portions;
+}
+
+void KitchenStation::removeEmptied(const std::vector<int>& ingredient_ids) {
+    if (ingredient_ids.empty()) {
+        return;
+    }
+    std::unique_lock<std::shared_mutex> structure = exclusiveLock();
+    for (int ingredient_id : ingredient_ids) {
+        // look again, another thread may have replenished or removed it meanwhile
+        int position = findStock(ingredient_id);
+        if (position >= 0 && ingredients_stock_[position].quantity == 0) {
+            eraseStock(position);
+        }
+    }
+}
+
+std::shared_lock<std::shared_mutex> KitchenStation::sharedLock() const {
+    if (!thread_safe_) {
+        return std::shared_lock<std::shared_mutex>();
+    }
+    return std::shared_lock<std::shared_mutex>(structure_mutex_);
+}
+
+std::unique_lock<std::shared_mutex> KitchenStation::exclusiveLock() const {
+    if (!thread_safe_) {
+        return std::unique_lock<std::shared_mutex>();
+    }
+    return std::unique_lock<std::shared_mutex>(structure_mutex_);
+}
+
+KitchenStation::StripeGuard::StripeGuard(const KitchenStation& station, const std::vector<std::pair<int, int>>& requirements)
+    : station_(station), stripes_() {
+    if (!station_.thread_safe_) {
+        return;
+    }
+    for (const std::pair<int, int>& requirement : requirements) {
+        stripes_.push_back(requirement.first % STRIPE_COUNT);
+    }
+    // one global order for every caller, so two cooks can never wait on each other
+    std::sort(stripes_.begin(), stripes_.end());
+    stripes_.erase(std::unique(stripes_.begin(), stripes_.end()), stripes_.end());
+    for (int stripe : stripes_) {
+        station_.stripes_[stripe].lock();
+    }
+}
+
+KitchenStation::StripeGuard::~StripeGuard() {
+    for (std::vector<int>::reverse_iterator it = stripes_.rbegin(); it != stripes_.rend(); ++it) {
+        station_.stripes_[*it].unlock();
+    }
+}
+
+int KitchenStation::findStock(int ingredient_id) const {
+    std::unordered_map<int, int>::const_iterator it = stock_index_.find(ingredient_id);
+    return it == stock_index_.end() ? -1 : it->second;
+}
+
+void KitchenStation::eraseStock(int position) {
+    stock_index_.erase(ingredients_stock_[position].getId());
+    ingredients_stock_.erase(ingredients_stock_.begin() + position);
+    // keep the stock in insertion order, shift the positions behind the gap
+    for (size_t i = position; i < ingredients_stock_.size(); i++) {
+        stock_index_[ingredients_stock_[i].getId()] = static_cast<int>(i);
     }
-    return false;
 }
\ No newline at end of file
@@ -5,6 +5,13 @@
 #include <string>
 #include <iomanip>
 #include <cctype>
+#include <unordered_map>
+#include <utility>
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <shared_mutex>
+#include <limits>
 #include "Dish.hpp"
 
 class KitchenStation {
@@ -12,9 +19,48 @@ class KitchenStation {
     private:
         std::string station_name_;
         std::vector<Dish*> dishes_;
+        // dish name -> dish, filled by assignDishToStation (names must not change while assigned)
+        std::unordered_map<std::string, Dish*> dish_index_;
         std::vector<Ingredient> ingredients_stock_;
+        // IngredientTable id -> position in ingredients_stock_, one entry per stocked ingredient
+        std::unordered_map<int, int> stock_index_;
 
-        bool isPresent(const std::string& dish_name) const;
+        // the assigned dish with that name, nullptr if none
+        Dish* findDish(const std::string& dish_name) const;
+        // position of the ingredient in ingredients_stock_, -1 if not stocked
+        int findStock(int ingredient_id) const;
+        // erases ingredients_stock_[position] and keeps stock_index_ in step
+        void eraseStock(int position);
+        // (stock position, total required) per distinct ingredient of the dish, sorted by position;
+        // false if an ingredient is not stocked
+        bool resolveRequirements(const Dish* dish, std::vector<std::pair<int, int>>& requirements) const;
+        // number of portions the stock covers for the resolved requirements
+        int portionsInStock(const std::vector<std::pair<int, int>>& requirements) const;
+        // erases the stock entries of these ingredients that are down to 0
+        void removeEmptied(const std::vector<int>& ingredient_ids);
+
+        // Thread-safe mode. structure_mutex_ guards dish_index_, stock_index_ and the
+        // shape of ingredients_stock_: readers and quantity updates hold it shared,
+        // adding or erasing entries holds it exclusive. Quantities are guarded by
+        // stripe locks picked by stock position, always taken in increasing order.
+        static constexpr int STRIPE_COUNT = 64;
+        bool thread_safe_;
+        mutable std::shared_mutex structure_mutex_;
+        mutable std::array<std::mutex, STRIPE_COUNT> stripes_;
+
+        // holds the stripe locks of a set of stock positions for one scope
+        class StripeGuard {
+            public:
+                StripeGuard(const KitchenStation& station, const std::vector<std::pair<int, int>>& requirements);
+                ~StripeGuard();
+                StripeGuard(const StripeGuard&) = delete;
+                StripeGuard& operator=(const StripeGuard&) = delete;
+            private:
+                const KitchenStation& station_;
+                std::vector<int> stripes_;  // sorted, distinct
+        };
+        std::shared_lock<std::shared_mutex> sharedLock() const;
+        std::unique_lock<std::shared_mutex> exclusiveLock() const;
 
 
 
@@ -37,6 +83,18 @@ class KitchenStation {
         bool canCompleteOrder(const std::string& dish_name) const;
         bool prepareDish(const std::string& dish_name);
         bool removeIngredient(const std::string& ingredient_name);
+        // prepares count portions at once, all or nothing; false if count < 1
+        bool prepareDishes(const std::string& dish_name, int count);
+        // portions of the dish the stock supports: 0 if the dish or an ingredient is
+        // missing, INT_MAX if the dish requires nothing
+        int maxPreparable(const std::string& dish_name) const;
+
+        // Turns thread-safe mode on or off. While on, every member below may be
+        // called from several threads at once; concurrent prepareDish calls that
+        // share no ingredient do not block each other, and overlapping ones never
+        // take more stock than there is. Must not race with other calls itself.
+        void setThreadSafe(bool enabled);
+        bool isThreadSafe() const;
 
 };
 
@@ -0,0 +1,61 @@
+#include "KitchenStats.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @return part as a percentage of whole, rounded to 2 decimal places; 0 if either is 0.
+ */
+double KitchenStats::percentage(int part, int whole) {
+    if (part == 0 || whole == 0) {
+        return 0;
+    }
+    return std::round(double(part) / double(whole) * 10000) / 100;
+}
+
+/**
+ * @param cuisine_counts Dish::CUISINE_TYPE_COUNT counts, indexed by Dish::CuisineType.
+ * @return The counts, sums, prep_time_mean and elaborate_percentage; the fields
+ * addDistribution() fills are 0.
+ */
+KitchenStats KitchenStats::fromCounts(int dish_count, const int* cuisine_counts, int prep_time_sum, int elaborate_count) {
+    KitchenStats stats = {};
+    stats.dish_count = dish_count;
+    if (dish_count == 0) {
+        return stats;
+    }
+    std::copy(cuisine_counts, cuisine_counts + Dish::CUISINE_TYPE_COUNT, stats.cuisine_counts);
+    stats.prep_time_sum = prep_time_sum;
+    stats.prep_time_mean = double(prep_time_sum) / dish_count;
+    stats.elaborate_count = elaborate_count;
+    stats.elaborate_percentage = percentage(elaborate_count, dish_count);
+    return stats;
+}
+
+/**
+ * @param prep_times One prep time per dish; reordered by the percentile selection.
+ * @param price_sum The sum of the dishes' prices.
+ * @post price_sum, price_mean, prep_time_min/max and the percentiles are set.
+ */
+void KitchenStats::finishDistribution(KitchenStats& stats, std::vector<int>& prep_times, double price_sum) {
+    if (prep_times.empty()) {
+        return;
+    }
+    std::pair<std::vector<int>::iterator, std::vector<int>::iterator> range =
+        std::minmax_element(prep_times.begin(), prep_times.end());
+    stats.prep_time_min = *range.first;
+    stats.prep_time_max = *range.second;
+    stats.price_sum = price_sum;
+    stats.price_mean = price_sum / prep_times.size();
+
+    // nearest rank: the smallest value with at least p% of the dishes at or below it
+    auto percentile = [&prep_times](int p) {
+        size_t rank = (size_t(p) * prep_times.size() + 99) / 100;
+        std::vector<int>::iterator nth = prep_times.begin() + (rank == 0 ? 0 : rank - 1);
+        std::nth_element(prep_times.begin(), nth, prep_times.end());
+        return *nth;
+    };
+    stats.prep_time_p50 = percentile(50);
+    stats.prep_time_p90 = percentile(90);
+    stats.prep_time_p99 = percentile(99);
+}
@@ -0,0 +1,125 @@
+#ifndef KITCHENSTATS_HPP
+#define KITCHENSTATS_HPP
+
+#include <vector>
+#include "Dish.hpp"
+
+/**
+ * @struct KitchenStats
+ * @brief Snapshot of the aggregate statistics over a set of dishes.
+ *
+ * compute() fills every field in one pass over the dishes. Owners that keep
+ * running totals start from fromCounts() instead and only scan the dishes,
+ * with addDistribution(), when they need prices, min/max or percentiles.
+ * Prep time percentiles use the nearest-rank method. Every field is 0 for
+ * an empty set.
+ */
+struct KitchenStats {
+    int dish_count;
+    int cuisine_counts[Dish::CUISINE_TYPE_COUNT]; // indexed by Dish::CuisineType
+    int prep_time_sum;
+    double prep_time_mean;
+    int prep_time_min;
+    int prep_time_max;
+    int prep_time_p50;
+    int prep_time_p90;
+    int prep_time_p99;
+    int elaborate_count;
+    double elaborate_percentage;  // rounded to 2 decimal places
+    double price_sum;
+    double price_mean;
+
+    /**
+     * The fields of one dish that the statistics read.
+     */
+    struct Row {
+        int prep_time;
+        double price;
+        int cuisine;           // Dish::CuisineType
+        int ingredient_count;
+    };
+
+    /**
+     * @param dish Any dish.
+     * @return The fields of the dish that the statistics read.
+     */
+    static Row rowOf(const Dish& dish) {
+        return Row{dish.getPrepTime(), dish.getPrice(), dish.getCuisineEnum(), static_cast<int>(dish.ingredientCount())};
+    }
+
+    /**
+     * @return True if a dish with these fields has 5 or more ingredients AND takes an hour or more to prepare.
+     */
+    static bool isElaborate(int ingredient_count, int prep_time) {
+        return ingredient_count >= 5 && prep_time >= 60;
+    }
+
+    /**
+     * @return part as a percentage of whole, rounded to 2 decimal places; 0 if either is 0.
+     */
+    static double percentage(int part, int whole);
+
+    /**
+     * Statistics that follow from running totals alone, without looking at any dish.
+     * @param cuisine_counts Dish::CUISINE_TYPE_COUNT counts, indexed by Dish::CuisineType.
+     * @return The counts, sums, prep_time_mean and elaborate_percentage; the fields
+     * addDistribution() fills are 0.
+     */
+    static KitchenStats fromCounts(int dish_count, const int* cuisine_counts, int prep_time_sum, int elaborate_count);
+
+    /**
+     * Fills price_sum, price_mean, prep_time_min/max and the percentiles in one pass.
+     * @param stats Statistics from fromCounts(); stats.dish_count dishes are read.
+     * @param row_at Called once with each index in [0, stats.dish_count), returns that dish's Row.
+     */
+    template <class RowAt>
+    static void addDistribution(KitchenStats& stats, RowAt row_at) {
+        std::vector<int> prep_times;
+        prep_times.reserve(stats.dish_count);
+        double price_sum = 0;
+        for (int i = 0; i < stats.dish_count; i++) {
+            Row row = row_at(i);
+            prep_times.push_back(row.prep_time);
+            price_sum += row.price;
+        }
+        finishDistribution(stats, prep_times, price_sum);
+    }
+
+    /**
+     * Aggregates dish_count dishes in a single pass, for owners without running totals.
+     * @param row_at Called once with each index in [0, dish_count), returns that dish's Row.
+     * @return The statistics of the dishes.
+     */
+    template <class RowAt>
+    static KitchenStats compute(int dish_count, RowAt row_at) {
+        int cuisine_counts[Dish::CUISINE_TYPE_COUNT] = {};
+        int prep_time_sum = 0;
+        int elaborate_count = 0;
+        double price_sum = 0;
+        std::vector<int> prep_times;
+        prep_times.reserve(dish_count);
+        for (int i = 0; i < dish_count; i++) {
+            Row row = row_at(i);
+            prep_times.push_back(row.prep_time);
+            prep_time_sum += row.prep_time;
+            price_sum += row.price;
+            cuisine_counts[row.cuisine]++;
+            if (isElaborate(row.ingredient_count, row.prep_time)) {
+                elaborate_count++;
+            }
+        }
+        KitchenStats stats = fromCounts(dish_count, cuisine_counts, prep_time_sum, elaborate_count);
+        finishDistribution(stats, prep_times, price_sum);
+        return stats;
+    }
+
+private:
+    /**
+     * @param prep_times One prep time per dish; reordered by the percentile selection.
+     * @param price_sum The sum of the dishes' prices.
+     * @post price_sum, price_mean, prep_time_min/max and the percentiles are set.
+     */
+    static void finishDistribution(KitchenStats& stats, std::vector<int>& prep_times, double price_sum);
+};
+
+#endif // KITCHENSTATS_HPP
@@ -19,8 +19,8 @@ MainCourse::MainCourse()
  * @param side_dishes The side dishes served with the main course.
  * @param gluten_free Flag indicating if the main course is gluten-free.
  */
-MainCourse::MainCourse(const std::string& name, const std::vector<Ingredient>& ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const CookingMethod &cooking_method, const std::string& protein_type, const std::vector<SideDish>& side_dishes, const bool &gluten_free)
-    : Dish(name, ingredients, prep_time, price, cuisine_type), cooking_method_(cooking_method), protein_type_(protein_type), side_dishes_(side_dishes), gluten_free_(gluten_free) {}
+MainCourse::MainCourse(std::string name, std::vector<Ingredient> ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const CookingMethod &cooking_method, std::string protein_type, std::vector<SideDish> side_dishes, const bool &gluten_free)
+    : Dish(std::move(name), std::move(ingredients), prep_time, price, cuisine_type), cooking_method_(cooking_method), protein_type_(std::move(protein_type)), side_dishes_(std::move(side_dishes)), gluten_free_(gluten_free) {}
 
 /**
  * Sets the cooking method of the main course.
@@ -43,8 +43,8 @@ MainCourse::CookingMethod MainCourse::getCookingMethod() const {
  * @param protein_type A string representing the type of protein.
  * @post Sets the private member `protein_type_` to the value of the parameter.
  */
-void MainCourse::setProteinType(const std::string& protein_type) {
-    protein_type_ = protein_type;
+void MainCourse::setProteinType(std::string protein_type) {
+    protein_type_ = std::move(protein_type);
 }
 
 /**
@@ -64,9 +64,17 @@ void MainCourse::addSideDish(const SideDish& side_dish) {
 }
 
 /**
- * @return A vector of SideDish structs representing the side dishes served with the main course.
+ * Adds a side dish to the main course without copying its name.
+ * @param side_dish A SideDish struct, moved into the `side_dishes_` vector.
  */
-std::vector<MainCourse::SideDish> MainCourse::getSideDishes() const {
+void MainCourse::addSideDish(SideDish&& side_dish) {
+    side_dishes_.push_back(std::move(side_dish));
+}
+
+/**
+ * @return A read-only reference to the SideDish structs representing the side dishes served with the main course.
+ */
+const std::vector<MainCourse::SideDish>& MainCourse::getSideDishes() const {
     return side_dishes_;
 }
 
@@ -97,7 +105,7 @@ void MainCourse::display() const
     std::cout << "Dish Name: " << getName() << std::endl;
     std::cout << "Ingredients: ";
     for (size_t i = 0; i < getIngredients().size(); ++i) {
-        std::cout << getIngredients()[i].name;
+        std::cout << getIngredients()[i].getName();
         if (i != getIngredients().size() - 1) {
             std::cout << ", ";
         }
@@ -105,7 +113,7 @@ void MainCourse::display() const
     std::cout << std::endl;
     std::cout << "Preparation Time: " << getPrepTime() << " minutes" << std::endl;
     std::cout << std::fixed << std::setprecision(2) << "Price: $" << getPrice() << std::endl;
-    std::cout << "Cuisine Type: " << getCuisineType() << std::endl;
+    std::cout << "Cuisine Type: " << cuisineToString(getCuisineEnum()) << std::endl;
 
     std::cout << "Cooking Method: " << cookingMethodToString(cooking_method_) << std::endl;
     std::cout << "Protein Type: " << protein_type_ << std::endl;
@@ -148,81 +156,26 @@ void MainCourse::display() const
     */
 void MainCourse::dietaryAccommodations(const DietaryRequest &request)
 {
-    if (request.vegetarian)
+    if (request.vegetarian || request.vegan)
     {
         protein_type_ = "Tofu";
-        bool first_replacement_done = false;
-        bool second_replacement_done = false;
-
-        // Create a local mutable copy of ingredients
-        std::vector<Ingredient> ingredients = getIngredients();
-
-        for (size_t i = 0; i < ingredients.size(); ++i)
-        {
-            if (ingredients[i].name == "Meat" || ingredients[i].name == "Chicken" || ingredients[i].name == "Fish" || 
-                ingredients[i].name == "Beef" || ingredients[i].name == "Pork" || ingredients[i].name == "Lamb" || 
-                ingredients[i].name == "Shrimp" || ingredients[i].name == "Bacon")
-            {
-                if (!first_replacement_done)
-                {
-                    ingredients[i].name = "Beans";  // First replacement
-                    first_replacement_done = true;
-                }
-                else if (!second_replacement_done)
-                {
-                    ingredients[i].name = "Mushrooms";  // Second replacement
-                    second_replacement_done = true;
-                }
-                else
-                {
-                    ingredients.erase(ingredients.begin() + i);  // Remove non-vegetarian item
-                    i--;  // Adjust index after erase
-                }
-            }
-        }
-        // Update ingredients
-        setIngredients(ingredients);
-        
     }
+    // meat substitution and dairy/egg removal share one pass over the ingredients
+    unsigned int remove_flags = 0;
     if (request.vegan)
     {
-        protein_type_ = "Tofu";
-
-        // Create a local mutable copy of ingredients
-        std::vector<Ingredient> ingredients = getIngredients();
-
-        if (!ingredients.empty())
-        {
-            for (size_t i = 0; i < ingredients.size(); ++i)
-            {
-                if (ingredients[i].name == "Milk" || ingredients[i].name == "Eggs" || ingredients[i].name == "Cheese" || 
-                    ingredients[i].name == "Butter" || ingredients[i].name == "Cream" || ingredients[i].name == "Yogurt")
-                {
-                    ingredients.erase(ingredients.begin() + i);  // Remove non-vegan item
-                    i--;  // Adjust index after erase
-                }
-            }
-        }
-        // Update ingredients
-        setIngredients(ingredients);
+        remove_flags |= CONTAINS_DAIRY_EGG;
     }
+    rewriteIngredients(request.vegetarian, remove_flags);
     if (request.gluten_free)
     {
         gluten_free_ = true;
-        if (side_dishes_.size() > 0)
-        {
-            for (size_t i = 0; i < side_dishes_.size(); ++i)
-            {
-                if (categoryToString(side_dishes_[i].category) == "GRAIN" || categoryToString(side_dishes_[i].category) == "PASTA" || categoryToString(side_dishes_[i].category) == "BREAD" || categoryToString(side_dishes_[i].category) == "STARCHES")
-                {
-                    side_dishes_.erase(side_dishes_.begin() + i);
-                    i--;
-                }
-            }
-        }
+        // stable single-pass removal of the gluten side dishes
+        side_dishes_.erase(std::remove_if(side_dishes_.begin(), side_dishes_.end(), [](const SideDish& side_dish) {
+            return side_dish.category == GRAIN || side_dish.category == PASTA ||
+                   side_dish.category == BREAD || side_dish.category == STARCHES;
+        }), side_dishes_.end());
     }
-    
-    
 }
 //enum Category { GRAIN, PASTA, LEGUME, BREAD, SALAD, SOUP, STARCHES, VEGETABLE };
 std::string MainCourse::categoryToString(const Category &category) const {
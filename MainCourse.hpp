@@ -4,6 +4,7 @@
 #include "Dish.hpp"
 #include <string>
 #include <vector>
+#include <algorithm>
 
 /**
  * @class MainCourse
@@ -50,7 +51,7 @@ public:
      * @param side_dishes The side dishes served with the main course.
      * @param gluten_free Flag indicating if the main course is gluten-free.
      */
-    MainCourse(const std::string& name, const std::vector<Ingredient>& ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const CookingMethod &cooking_method, const std::string& protein_type, const std::vector<SideDish>& side_dishes, const bool &gluten_free);
+    MainCourse(std::string name, std::vector<Ingredient> ingredients, const int &prep_time, const double &price, const CuisineType &cuisine_type, const CookingMethod &cooking_method, std::string protein_type, std::vector<SideDish> side_dishes, const bool &gluten_free);
 
     /**
      * Sets the cooking method of the main course.
@@ -69,7 +70,7 @@ public:
      * @param protein_type A string representing the type of protein.
      * @post Sets the private member `protein_type_` to the value of the parameter.
      */
-    void setProteinType(const std::string& protein_type);
+    void setProteinType(std::string protein_type);
 
     /**
      * @return The type of protein in the main course.
@@ -84,9 +85,15 @@ public:
     void addSideDish(const SideDish& side_dish);
 
     /**
-     * @return A vector of SideDish structs representing the side dishes served with the main course.
+     * Adds a side dish to the main course without copying its name.
+     * @param side_dish A SideDish struct, moved into the `side_dishes_` vector.
      */
-    std::vector<SideDish> getSideDishes() const;
+    void addSideDish(SideDish&& side_dish);
+
+    /**
+     * @return A read-only reference to the SideDish structs representing the side dishes served with the main course.
+     */
+    const std::vector<SideDish>& getSideDishes() const;
 
     /**
      * Sets the gluten-free flag of the main course.
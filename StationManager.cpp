@@ -279,9 +279,10 @@ bool StationManager::replenishStationIngredientFromBackup(std::string station_na
     KitchenStation *station = findStation(station_name);
     if(station == nullptr) return false;//Finds station name. If cannot find, ingredient cannot be added
 
+    int ingredient_id = IngredientTable::find(ingredient_name);
     bool check = false;
     for(size_t i = 0; i < backup_ingredients_.size(); i++){ //search for ingredient
-        if(backup_ingredients_[i].name == ingredient_name && backup_ingredients_[i].quantity >= quantity){
+        if(backup_ingredients_[i].getId() == ingredient_id && backup_ingredients_[i].quantity >= quantity){
             check = true;
             backup_ingredients_[i].quantity -= quantity;
             if(backup_ingredients_[i].quantity == 0){
@@ -294,9 +295,7 @@ bool StationManager::replenishStationIngredientFromBackup(std::string station_na
     } 
 
     //Assume backup ingredient was found and already removed from backup_ingredients_
-    Ingredient replenish;
-    replenish.name = ingredient_name;
-    replenish.quantity = quantity;
+    Ingredient replenish(ingredient_name, quantity, 0, 0.0);
     station->replenishStationIngredients(replenish);
     return true;
 }
@@ -308,7 +307,7 @@ bool StationManager::replenishStationIngredientFromBackup(std::string station_na
  * @post The backup_ingredients_ vector is replaced with the provided ingredients.
  * @return True if the ingredients were added; false otherwise.*/
 bool StationManager::addBackupIngredients(std::vector<Ingredient> ingredients){
-    backup_ingredients_ = ingredients;
+    backup_ingredients_ = std::move(ingredients);
     return true;
 }
 
@@ -322,7 +321,7 @@ bool StationManager::addBackupIngredients(std::vector<Ingredient> ingredients){
 bool StationManager::addBackupIngredient(Ingredient ingredient){
     if(ingredient.quantity <= 0) return false; //whats the edge case to be false?
     for(size_t i=0;i<backup_ingredients_.size();i++){
-        if(backup_ingredients_[i].name == ingredient.name){
+        if(backup_ingredients_[i].getId() == ingredient.getId()){
             backup_ingredients_[i].quantity += ingredient.quantity;
             return true;
         }
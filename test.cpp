@@ -1,8 +1,23 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
 #include "Dish.hpp"
 #include "Appetizer.hpp"
 #include "MainCourse.hpp"
 #include "Dessert.hpp"
+#include "Kitchen.hpp"
+#include "KitchenStation.hpp"
 //fist project main test
 // int main(){
 //     Dish Dish0;
@@ -33,70 +48,516 @@
 //     DishTest.display();
 // }
 
-//second project main test
-int main(){
-    Appetizer Appetizer0;
-    Appetizer0 = Appetizer();
-    Appetizer0.setPrepTime(0);
-    Appetizer0.setPrice(0.00);
-    Appetizer0.setCuisineType(Dish::OTHER);
-    Appetizer0.getCuisineType();
-    Appetizer0.setSpicinessLevel(7);
-    Appetizer0.getSpicinessLevel();
-    Appetizer0.setServingStyle(Appetizer::FAMILY_STYLE);
-    Appetizer0.getServingStyle();
-    Appetizer0.setVegetarian(true);
-    Appetizer0.isVegetarian();
-    Appetizer0.displayAppetizer();
-    std::cout<<'\n';
-
-    MainCourse MainCourse0;
-    MainCourse0 = MainCourse();
-    std::vector<std::string> random = {"Chicken", "Olive Oil", "Garlic", "Rosemary"};
-    //MainCourse::CuisineType rann = MainCourse::AMERICAN; //calling an enum
-    MainCourse::SideDish sideDish0 = {"Mash Potatoes",MainCourse::STARCHES};
-    MainCourse::SideDish sideDish1 = {"Green Beans", MainCourse::VEGETABLE};
-    std::vector<MainCourse::SideDish> sideDishTest = {sideDish0, sideDish1};
-    MainCourse0 = MainCourse("Grilled Chicken", random, 30, 18.99, Dish::CuisineType::AMERICAN, MainCourse::CookingMethod::GRILLED, "Chicken", sideDishTest, true);
-    MainCourse0.setName("Grilled Chicken");
-    MainCourse0.getName();
-    MainCourse0.setIngredients(random);
-    MainCourse0.getIngredients();
-    MainCourse0.setPrepTime(30);
-    MainCourse0.getPrepTime();
-    MainCourse0.setPrice(18.99);
-    MainCourse0.getPrice();
-    MainCourse0.setCookingMethod(MainCourse::GRILLED);
-    MainCourse0.getCookingMethod();
-    MainCourse0.setProteinType("Chicken");
-    MainCourse0.getProteinType();
-    // MainCourse0.addSideDish({"Mash Potatoes",MainCourse::STARCHES});
-    //MainCourse0.addSideDish({"Green Beans", MainCourse::VEGETABLE});
-    MainCourse0.getSideDishes();
-    MainCourse0.setGlutenFree(true);
-    MainCourse0.isGlutenFree();
-    MainCourse0.displayMainCourse();
-    std::cout<<'\n';
-
-    Dessert Dessert0;
-    Dessert0 = Dessert();
-    std::vector<std::string> DessertRandom = {"Flour", "Sugar", "Cocoa Powder", "Eggs"};
-    Dessert0 = Dessert("Chocolate Cake", DessertRandom, 45, 7.99, Dish::CuisineType::FRENCH, Dessert::FlavorProfile::SWEET, 9, false);
-    Dessert0.setName("Chocolate Cake");
-    Dessert0.getName();
-    Dessert0.setIngredients(DessertRandom);
-    Dessert0.getIngredients();
-    Dessert0.setPrepTime(45);
-    Dessert0.getPrepTime();
-    Dessert0.setPrice(7.99);
-    Dessert0.getPrice();
-    Dessert0.setCuisineType(Dessert::FRENCH);
-    Dessert0.getCuisineType();
-    Dessert0.setFlavorProfile(Dessert::SWEET);
-    Dessert0.getFlavorProfile();
-    Dessert0.setSweetnessLevel(9);
-    Dessert0.getSweetnessLevel();
-    Dessert0.setContainsNuts(false);
-    Dessert0.containsNuts();
-    Dessert0.displayDessert();
+
+namespace {
+// quantity of the named ingredient in the station's stock, 0 if it is not stocked
+int stockOf(const KitchenStation& station, const std::string& name) {
+    for (const Ingredient& ingredient : station.getIngredientsStock()) {
+        if (ingredient.getName() == name) {
+            return ingredient.quantity;
+        }
+    }
+    return 0;
+}
+
+Appetizer* stationDish(const std::string& name, std::vector<Ingredient> ingredients) {
+    return new Appetizer(name, std::move(ingredients), 10, 5.0, Dish::OTHER, Appetizer::PLATED, 1, false);
+}
+
+// names of the kitchen's open orders, in stored order
+std::vector<std::string> orderNames(Kitchen& kitchen) {
+    std::vector<std::string> names;
+    kitchen.releaseIf([&names](const Dish* dish) {
+        names.push_back(dish->getName());
+        return false;
+    });
+    return names;
+}
+
+// file in the working directory, removed when the test case ends
+struct TempFile {
+    std::string name;
+    explicit TempFile(std::string file_name) : name(std::move(file_name)) {}
+    ~TempFile() { std::remove(name.c_str()); }
+};
+
+// writes dish_count generated rows in the CSV format Kitchen(filename) reads,
+// mixing every dish type and ingredients from each dietary group
+void writeMenu(const std::string& filename, int dish_count) {
+    const char* pantry[] = {"Chicken", "Beef", "Cheese", "Eggs", "Flour", "Bread", "Almonds",
+                            "Walnuts", "Tomato", "Basil", "Rice", "Sugar", "Olive Oil"};
+    const char* cuisines[] = {"ITALIAN", "MEXICAN", "CHINESE", "INDIAN", "AMERICAN", "FRENCH", "OTHER"};
+    const char* styles[] = {"PLATED", "FAMILY_STYLE", "BUFFET"};
+    const char* methods[] = {"GRILLED", "BAKED", "BOILED", "FRIED", "STEAMED", "RAW"};
+    const char* sides[] = {"Rice:GRAIN", "Penne:PASTA", "Garlic Bread:BREAD", "Green Beans:VEGETABLE"};
+    const char* profiles[] = {"SWEET", "BITTER", "SOUR", "SALTY", "UMAMI"};
+    std::ofstream file(filename);
+    file << "dish_type,name,ingredients,prep_time,price,cuisine,additional\n";
+    for (int i = 0; i < dish_count; i++) {
+        std::string ingredients;
+        for (int k = 0; k < 2 + i % 5; k++) {
+            ingredients += (k == 0 ? "" : ";") + std::string(pantry[(i * 7 + k * 3) % 13]);
+        }
+        std::ostringstream row;
+        row << ",Dish " << i << "," << ingredients << "," << 10 + i % 90 << "," << 5 + i % 20 << ".5,"
+            << cuisines[i % 7] << ",";
+        switch (i % 3) {
+        case 0:
+            file << "APPETIZER" << row.str() << styles[(i / 3) % 3] << ";" << i % 10 << ";"
+                 << (i % 2 == 0 ? "true" : "false") << "\n";
+            break;
+        case 1:
+            file << "MAINCOURSE" << row.str() << methods[i % 6] << ";" << pantry[i % 4] << ";"
+                 << sides[i % 4] << "|" << sides[(i + 1) % 4] << ";" << (i % 5 == 0 ? "true" : "false") << "\n";
+            break;
+        default:
+            file << "DESSERT" << row.str() << profiles[i % 5] << ";" << i % 10 << ";"
+                 << (i % 4 == 0 ? "true" : "false") << "\n";
+            break;
+        }
+    }
+}
+
+// everything displayMenu() prints for the kitchen, in order
+std::string menuOf(const Kitchen& kitchen) {
+    std::ostringstream captured;
+    std::streambuf* previous = std::cout.rdbuf(captured.rdbuf());
+    kitchen.displayMenu();
+    std::cout.rdbuf(previous);
+    return captured.str();
+}
+}
+
+TEST_CASE("KitchenStation conserves stock under concurrent orders and replenishment") {
+    KitchenStation station("Grill");
+    station.setThreadSafe(true);
+    station.replenishStationIngredients(Ingredient("Flour", 30000, 0, 1.0));
+    station.replenishStationIngredients(Ingredient("Butter", 20000, 0, 1.0));
+    station.replenishStationIngredients(Ingredient("Saffron", 1000, 0, 1.0));
+    station.assignDishToStation(stationDish("Roux", {Ingredient("Flour", 0, 1, 1.0), Ingredient("Butter", 0, 1, 1.0)}));
+    station.assignDishToStation(stationDish("Flatbread", {Ingredient("Flour", 0, 2, 1.0)}));
+    station.assignDishToStation(stationDish("Risotto", {Ingredient("Saffron", 0, 1, 1.0)}));
+
+    const int thread_count = 8;
+    const int rounds = 2000;
+    std::atomic<int> roux(0), flatbread(0), risotto(0), replenished(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; t++) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < rounds; i++) {
+                switch ((i + t) % 4) {
+                case 0:
+                    roux += station.prepareDish("Roux") ? 1 : 0;
+                    break;
+                case 1:
+                    flatbread += station.prepareDishes("Flatbread", 3) ? 3 : 0;
+                    break;
+                case 2:
+                    risotto += station.prepareDish("Risotto") ? 1 : 0;
+                    break;
+                default:
+                    station.replenishStationIngredients(Ingredient("Flour", 2, 0, 1.0));
+                    replenished += 2;
+                    station.canCompleteOrder("Roux");
+                    break;
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (const Ingredient& ingredient : station.getIngredientsStock()) {
+        CHECK(ingredient.quantity > 0);
+    }
+    CHECK(risotto == 1000);
+    CHECK(stockOf(station, "Saffron") == 0);
+    CHECK(stockOf(station, "Butter") == 20000 - roux);
+    CHECK(stockOf(station, "Flour") == 30000 + replenished - roux - 2 * flatbread);
+}
+
+TEST_CASE("KitchenStation::maxPreparable counts the portions the stock covers") {
+    KitchenStation station("Pastry");
+    station.replenishStationIngredients(Ingredient("Flour", 9, 0, 1.0));
+    station.replenishStationIngredients(Ingredient("Eggs", 7, 0, 1.0));
+    station.assignDishToStation(stationDish("Water", {}));
+    station.assignDishToStation(stationDish("Crepe", {Ingredient("Flour", 0, 2, 1.0), Ingredient("Eggs", 0, 1, 1.0)}));
+    station.assignDishToStation(stationDish("Brioche", {Ingredient("Flour", 0, 1, 1.0), Ingredient("Flour", 0, 2, 1.0)}));
+    station.assignDishToStation(stationDish("Tart", {Ingredient("Flour", 0, 1, 1.0), Ingredient("Truffle", 0, 1, 1.0)}));
+
+    // a dish that requires nothing is never limited by the stock
+    CHECK(station.maxPreparable("Water") == std::numeric_limits<int>::max());
+    // the scarcest ingredient decides: Flour covers 4, Eggs 7
+    CHECK(station.maxPreparable("Crepe") == 4);
+    // an ingredient listed twice needs the sum of both requirements
+    CHECK(station.maxPreparable("Brioche") == 3);
+    // an unassigned dish or an unstocked ingredient allows nothing
+    CHECK(station.maxPreparable("Souffle") == 0);
+    CHECK(station.maxPreparable("Tart") == 0);
+    CHECK(station.canCompleteOrder("Crepe"));
+    CHECK_FALSE(station.canCompleteOrder("Tart"));
+    // asking does not touch the stock
+    CHECK(stockOf(station, "Flour") == 9);
+    CHECK(stockOf(station, "Eggs") == 7);
+}
+
+TEST_CASE("KitchenStation::prepareDishes deducts every portion or nothing") {
+    KitchenStation station("Pastry");
+    station.replenishStationIngredients(Ingredient("Flour", 9, 0, 1.0));
+    station.replenishStationIngredients(Ingredient("Eggs", 7, 0, 1.0));
+    station.assignDishToStation(stationDish("Crepe", {Ingredient("Flour", 0, 2, 1.0), Ingredient("Eggs", 0, 1, 1.0)}));
+    station.assignDishToStation(stationDish("Brioche", {Ingredient("Flour", 0, 1, 1.0), Ingredient("Flour", 0, 2, 1.0)}));
+
+    CHECK_FALSE(station.prepareDishes("Crepe", 0));
+    CHECK_FALSE(station.prepareDishes("Crepe", -1));
+    CHECK_FALSE(station.prepareDishes("Souffle", 1));
+    // one portion more than the Flour covers fails without deducting anything
+    CHECK_FALSE(station.prepareDishes("Crepe", 5));
+    CHECK(stockOf(station, "Flour") == 9);
+    CHECK(stockOf(station, "Eggs") == 7);
+
+    CHECK(station.prepareDishes("Crepe", 2));
+    CHECK(stockOf(station, "Flour") == 5);
+    CHECK(stockOf(station, "Eggs") == 5);
+
+    // Flour listed twice takes 1 + 2 per portion; a third portion would need 9
+    CHECK_FALSE(station.prepareDishes("Brioche", 2));
+    CHECK(stockOf(station, "Flour") == 5);
+    CHECK(station.prepareDishes("Brioche", 1));
+    CHECK(stockOf(station, "Flour") == 2);
+
+    // the last Flour goes, and its stock entry with it
+    CHECK(station.prepareDishes("Crepe", 1));
+    CHECK(station.getIngredientsStock().size() == 1);
+    CHECK(stockOf(station, "Eggs") == 4);
+    CHECK(station.maxPreparable("Crepe") == 0);
+    CHECK_FALSE(station.prepareDishes("Crepe", 1));
+
+    station.replenishStationIngredients(Ingredient("Flour", 4, 0, 1.0));
+    CHECK(station.maxPreparable("Crepe") == 2);
+    CHECK(station.prepareDishes("Crepe", 2));
+    CHECK(stockOf(station, "Eggs") == 2);
 }
+
+TEST_CASE("Kitchen loads the same orders with any number of threads") {
+    TempFile menu("test_menu.csv");
+    writeMenu(menu.name, 2000);
+    Kitchen serial(menu.name);
+    REQUIRE(serial.getCurrentSize() == 2000);
+    std::string expected = menuOf(serial);
+    for (unsigned int thread_count : {0u, 1u, 2u, 3u, 8u, 5000u}) {
+        CAPTURE(thread_count);
+        Kitchen parallel(menu.name, thread_count);
+        CHECK(parallel.getCurrentSize() == serial.getCurrentSize());
+        CHECK(parallel.getPrepTimeSum() == serial.getPrepTimeSum());
+        CHECK(parallel.elaborateDishCount() == serial.elaborateDishCount());
+        CHECK(menuOf(parallel) == expected);
+    }
+}
+
+TEST_CASE("Kitchen snapshots round-trip and truncated snapshots are rejected") {
+    TempFile menu("test_menu.csv");
+    TempFile snapshot("test_snapshot.bin");
+    TempFile truncated("test_truncated.bin");
+    writeMenu(menu.name, 500);
+    Kitchen original(menu.name);
+    REQUIRE(original.saveSnapshot(snapshot.name));
+
+    Kitchen restored;
+    REQUIRE(restored.loadSnapshot(snapshot.name));
+    CHECK(restored.getCurrentSize() == original.getCurrentSize());
+    CHECK(restored.getPrepTimeSum() == original.getPrepTimeSum());
+    CHECK(restored.elaborateDishCount() == original.elaborateDishCount());
+    CHECK(menuOf(restored) == menuOf(original));
+
+    std::ifstream in(snapshot.name, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    REQUIRE(bytes.size() > 8);
+    for (size_t length : {size_t(0), size_t(3), bytes.size() / 2, bytes.size() - 1}) {
+        CAPTURE(length);
+        std::ofstream(truncated.name, std::ios::binary).write(bytes.data(), length);
+        Kitchen kitchen(menu.name);
+        std::string before = menuOf(kitchen);
+        CHECK_FALSE(kitchen.loadSnapshot(truncated.name));
+        CHECK(menuOf(kitchen) == before);
+    }
+    CHECK_FALSE(restored.loadSnapshot("test_missing_snapshot.bin"));
+}
+
+TEST_CASE("Parallel dietaryAdjustment matches the serial one") {
+    TempFile menu("test_menu.csv");
+    writeMenu(menu.name, 1500);
+    const Dish::DietaryRequest requests[] = {
+        {true, false, false, false, false, false},
+        {false, true, true, false, false, false},
+        {true, false, false, true, true, true},
+        {true, true, true, true, true, true},
+    };
+    for (const Dish::DietaryRequest& request : requests) {
+        Kitchen serial(menu.name);
+        serial.dietaryAdjustment(request);
+        std::string expected = menuOf(serial);
+        for (unsigned int thread_count : {2u, 3u, 8u}) {
+            CAPTURE(thread_count);
+            Kitchen parallel(menu.name);
+            parallel.dietaryAdjustment(request, thread_count);
+            CHECK(parallel.getPrepTimeSum() == serial.getPrepTimeSum());
+            CHECK(parallel.elaborateDishCount() == serial.elaborateDishCount());
+            CHECK(menuOf(parallel) == expected);
+        }
+    }
+}
+
+TEST_CASE("Kitchen::clear resets the running totals") {
+    Appetizer first("Bruschetta", {Ingredient("Bread", 0, 1, 1.0)}, 10, 6.5, Dish::ITALIAN, Appetizer::PLATED, 2, true);
+    Appetizer second("Caprese", {Ingredient("Tomato", 0, 1, 1.0)}, 15, 7.5, Dish::ITALIAN, Appetizer::PLATED, 0, true);
+    Kitchen kitchen;
+    REQUIRE(kitchen.newOrder(&first));
+    REQUIRE(kitchen.newOrder(&second));
+    kitchen.clear();
+    CHECK(kitchen.getCurrentSize() == 0);
+    CHECK(kitchen.tallyCuisineTypes(Dish::ITALIAN) == 0);
+    CHECK(kitchen.tallyCuisineTypes("ITALIAN") == 0);
+    REQUIRE(kitchen.newOrder(&second));
+    CHECK(kitchen.getPrepTimeSum() == 15);
+    CHECK(kitchen.tallyCuisineTypes(Dish::ITALIAN) == 1);
+}
+
+TEST_CASE("Kitchen::releaseIf keeps the order and totals when the last order is released") {
+    std::vector<Ingredient> five = {Ingredient("Flour", 0, 1, 1.0), Ingredient("Eggs", 0, 1, 1.0), Ingredient("Sugar", 0, 1, 1.0),
+                                    Ingredient("Butter", 0, 1, 1.0), Ingredient("Milk", 0, 1, 1.0)};
+    Dessert a("A", five, 90, 9.0, Dish::FRENCH, Dessert::SWEET, 5, false);
+    Dessert b("B", five, 20, 8.0, Dish::ITALIAN, Dessert::SWEET, 5, false);
+    Dessert c("C", five, 70, 7.0, Dish::FRENCH, Dessert::SWEET, 5, false);
+    Dessert d("D", five, 30, 6.0, Dish::MEXICAN, Dessert::SWEET, 5, false);
+    Dessert e("E", five, 80, 5.0, Dish::ITALIAN, Dessert::SWEET, 5, false);
+    Kitchen kitchen;
+    kitchen.setColumnarMirror(true);
+    for (Dessert* dessert : {&a, &b, &c, &d, &e}) {
+        REQUIRE(kitchen.newOrder(dessert));
+    }
+
+    std::vector<Dish*> released = kitchen.releaseIf([](const Dish* dish) {
+        return dish->getCuisineEnum() == Dish::ITALIAN;
+    });
+    REQUIRE(released.size() == 2);
+    CHECK(released[0] == &b);
+    CHECK(released[1] == &e);
+    CHECK(orderNames(kitchen) == std::vector<std::string>{"A", "C", "D"});
+    CHECK(kitchen.getPrepTimeSum() == 190);
+    CHECK(kitchen.elaborateDishCount() == 2);
+    CHECK(kitchen.tallyCuisineTypes(Dish::ITALIAN) == 0);
+    CHECK(kitchen.tallyCuisineTypes(Dish::FRENCH) == 2);
+    CHECK(kitchen.getColumns().prep_times == std::vector<int>{90, 70, 30});
+    CHECK_FALSE(kitchen.contains(&e));
+
+    // the compacted slots must still be found by the membership index
+    CHECK(kitchen.serveDish(&d));
+    CHECK(kitchen.serveDish(&a));
+    CHECK(orderNames(kitchen) == std::vector<std::string>{"C"});
+    CHECK(kitchen.getPrepTimeSum() == 70);
+}
+
+TEST_CASE("Kitchen::loadSnapshot never restores an out-of-range enum") {
+    TempFile menu("test_menu.csv");
+    TempFile snapshot("test_snapshot.bin");
+    TempFile corrupted("test_corrupted.bin");
+    writeMenu(menu.name, 3);
+    Kitchen original(menu.name);
+    REQUIRE(original.saveSnapshot(snapshot.name));
+    std::ifstream in(snapshot.name, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    // overwrite one byte at a time; a snapshot that still loads must hold valid enums
+    for (size_t position = 0; position < bytes.size(); position++) {
+        std::string damaged = bytes;
+        damaged[position] = char(0xFF);
+        std::ofstream(corrupted.name, std::ios::binary).write(damaged.data(), damaged.size());
+        Kitchen kitchen;
+        if (!kitchen.loadSnapshot(corrupted.name)) {
+            continue;
+        }
+        kitchen.releaseIf([position](const Dish* dish) {
+            CAPTURE(position);
+            CHECK(dish->getCuisineEnum() < Dish::CUISINE_TYPE_COUNT);
+            if (const Appetizer* appetizer = dynamic_cast<const Appetizer*>(dish)) {
+                CHECK(appetizer->getServingStyle() <= Appetizer::BUFFET);
+            }
+            else if (const MainCourse* main_course = dynamic_cast<const MainCourse*>(dish)) {
+                CHECK(main_course->getCookingMethod() <= MainCourse::RAW);
+                for (const MainCourse::SideDish& side : main_course->getSideDishes()) {
+                    CHECK(side.category <= MainCourse::VEGETABLE);
+                }
+            }
+            else if (const Dessert* dessert = dynamic_cast<const Dessert*>(dish)) {
+                CHECK(dessert->getFlavorProfile() <= Dessert::UMAMI);
+            }
+            return false;
+        });
+    }
+}
+
+TEST_CASE("Kitchen's columnar mirror and totals follow random updates") {
+    std::vector<std::unique_ptr<Dish>> pool;
+    const char* pantry[] = {"Flour", "Eggs", "Sugar", "Butter", "Milk", "Salt"};
+    for (int i = 0; i < 40; i++) {
+        std::vector<Ingredient> ingredients;
+        for (int k = 0; k < 1 + i % 6; k++) {
+            ingredients.emplace_back(pantry[k], 0, 1, 1.0);
+        }
+        std::string name = "Dish " + std::to_string(i);
+        Dish::CuisineType cuisine = static_cast<Dish::CuisineType>(i % Dish::CUISINE_TYPE_COUNT);
+        int prep_time = 15 * (i % 7);
+        if (i % 3 == 0) {
+            pool.emplace_back(new Appetizer(name, ingredients, prep_time, i, cuisine, Appetizer::PLATED, 1, false));
+        }
+        else if (i % 3 == 1) {
+            pool.emplace_back(new MainCourse(name, ingredients, prep_time, i, cuisine, MainCourse::BAKED, "Tofu", {}, false));
+        }
+        else {
+            pool.emplace_back(new Dessert(name, ingredients, prep_time, i, cuisine, Dessert::SWEET, 3, false));
+        }
+    }
+
+    std::mt19937 random(235);
+    Kitchen kitchen;
+    kitchen.setColumnarMirror(true);
+    for (int step = 0; step < 3000; step++) {
+        Dish* dish = pool[random() % pool.size()].get();
+        int operation = random() % 100;
+        if (operation < 45) {
+            kitchen.newOrder(dish);
+        }
+        else if (operation < 80) {
+            kitchen.serveDish(dish);
+        }
+        else if (operation < 90) {
+            int limit = random() % 100;
+            kitchen.releaseIf([limit](const Dish* open) { return open->getPrepTime() < limit; });
+        }
+        else if (operation < 98) {
+            std::vector<Dish*> batch;
+            for (int k = 0; k < 5; k++) {
+                batch.push_back(pool[random() % pool.size()].get());
+            }
+            kitchen.newOrders(batch);
+        }
+        else {
+            kitchen.clear();
+        }
+
+        const Kitchen::OrderColumns& columns = kitchen.getColumns();
+        REQUIRE(columns.prep_times.size() == size_t(kitchen.getCurrentSize()));
+        REQUIRE(columns.dish_tags.size() == size_t(kitchen.getCurrentSize()));
+        int position = 0, prep_time_sum = 0, elaborate = 0;
+        int cuisines[Dish::CUISINE_TYPE_COUNT] = {};
+        bool columns_match = true;
+        std::vector<KitchenStats::Row> rows;
+        kitchen.releaseIf([&](const Dish* open) {
+            rows.push_back(KitchenStats::rowOf(*open));
+            Kitchen::DishTag tag = dynamic_cast<const Appetizer*>(open) ? Kitchen::APPETIZER_TAG
+                                 : dynamic_cast<const MainCourse*>(open) ? Kitchen::MAINCOURSE_TAG : Kitchen::DESSERT_TAG;
+            columns_match = columns_match && columns.prep_times[position] == open->getPrepTime()
+                && columns.prices[position] == open->getPrice() && columns.cuisines[position] == open->getCuisineEnum()
+                && columns.ingredient_counts[position] == int(open->ingredientCount()) && columns.dish_tags[position] == tag;
+            prep_time_sum += open->getPrepTime();
+            elaborate += Kitchen::isElaborate(open) ? 1 : 0;
+            cuisines[open->getCuisineEnum()]++;
+            position++;
+            return false;
+        });
+        CAPTURE(step);
+        REQUIRE(columns_match);
+        REQUIRE(kitchen.getPrepTimeSum() == prep_time_sum);
+        REQUIRE(kitchen.elaborateDishCount() == elaborate);
+        for (int cuisine = 0; cuisine < Dish::CUISINE_TYPE_COUNT; cuisine++) {
+            REQUIRE(kitchen.tallyCuisineTypes(static_cast<Dish::CuisineType>(cuisine)) == cuisines[cuisine]);
+        }
+
+        // getStats mixes the running totals with a scan; it must agree with a full pass
+        KitchenStats stats = kitchen.getStats();
+        KitchenStats scanned = KitchenStats::compute(int(rows.size()), [&rows](int i) { return rows[i]; });
+        REQUIRE(stats.dish_count == scanned.dish_count);
+        REQUIRE(std::equal(stats.cuisine_counts, stats.cuisine_counts + Dish::CUISINE_TYPE_COUNT, scanned.cuisine_counts));
+        REQUIRE(stats.prep_time_sum == scanned.prep_time_sum);
+        REQUIRE(stats.prep_time_mean == scanned.prep_time_mean);
+        REQUIRE(stats.prep_time_min == scanned.prep_time_min);
+        REQUIRE(stats.prep_time_max == scanned.prep_time_max);
+        REQUIRE(stats.prep_time_p50 == scanned.prep_time_p50);
+        REQUIRE(stats.prep_time_p90 == scanned.prep_time_p90);
+        REQUIRE(stats.prep_time_p99 == scanned.prep_time_p99);
+        REQUIRE(stats.elaborate_count == scanned.elaborate_count);
+        REQUIRE(stats.elaborate_percentage == scanned.elaborate_percentage);
+        REQUIRE(stats.price_sum == scanned.price_sum);
+        REQUIRE(stats.price_mean == scanned.price_mean);
+    }
+}
+
+//second project main test
+// int main(){
+//     Appetizer Appetizer0;
+//     Appetizer0 = Appetizer();
+//     Appetizer0.setPrepTime(0);
+//     Appetizer0.setPrice(0.00);
+//     Appetizer0.setCuisineType(Dish::OTHER);
+//     Appetizer0.getCuisineType();
+//     Appetizer0.setSpicinessLevel(7);
+//     Appetizer0.getSpicinessLevel();
+//     Appetizer0.setServingStyle(Appetizer::FAMILY_STYLE);
+//     Appetizer0.getServingStyle();
+//     Appetizer0.setVegetarian(true);
+//     Appetizer0.isVegetarian();
+//     Appetizer0.displayAppetizer();
+//     std::cout<<'\n';
+//
+//     MainCourse MainCourse0;
+//     MainCourse0 = MainCourse();
+//     std::vector<std::string> random = {"Chicken", "Olive Oil", "Garlic", "Rosemary"};
+//     //MainCourse::CuisineType rann = MainCourse::AMERICAN; //calling an enum
+//     MainCourse::SideDish sideDish0 = {"Mash Potatoes",MainCourse::STARCHES};
+//     MainCourse::SideDish sideDish1 = {"Green Beans", MainCourse::VEGETABLE};
+//     std::vector<MainCourse::SideDish> sideDishTest = {sideDish0, sideDish1};
+//     MainCourse0 = MainCourse("Grilled Chicken", random, 30, 18.99, Dish::CuisineType::AMERICAN, MainCourse::CookingMethod::GRILLED, "Chicken", sideDishTest, true);
+//     MainCourse0.setName("Grilled Chicken");
+//     MainCourse0.getName();
+//     MainCourse0.setIngredients(random);
+//     MainCourse0.getIngredients();
+//     MainCourse0.setPrepTime(30);
+//     MainCourse0.getPrepTime();
+//     MainCourse0.setPrice(18.99);
+//     MainCourse0.getPrice();
+//     MainCourse0.setCookingMethod(MainCourse::GRILLED);
+//     MainCourse0.getCookingMethod();
+//     MainCourse0.setProteinType("Chicken");
+//     MainCourse0.getProteinType();
+//     // MainCourse0.addSideDish({"Mash Potatoes",MainCourse::STARCHES});
+//     //MainCourse0.addSideDish({"Green Beans", MainCourse::VEGETABLE});
+//     MainCourse0.getSideDishes();
+//     MainCourse0.setGlutenFree(true);
+//     MainCourse0.isGlutenFree();
+//     MainCourse0.displayMainCourse();
+//     std::cout<<'\n';
+//
+//     Dessert Dessert0;
+//     Dessert0 = Dessert();
+//     std::vector<std::string> DessertRandom = {"Flour", "Sugar", "Cocoa Powder", "Eggs"};
+//     Dessert0 = Dessert("Chocolate Cake", DessertRandom, 45, 7.99, Dish::CuisineType::FRENCH, Dessert::FlavorProfile::SWEET, 9, false);
+//     Dessert0.setName("Chocolate Cake");
+//     Dessert0.getName();
+//     Dessert0.setIngredients(DessertRandom);
+//     Dessert0.getIngredients();
+//     Dessert0.setPrepTime(45);
+//     Dessert0.getPrepTime();
+//     Dessert0.setPrice(7.99);
+//     Dessert0.getPrice();
+//     Dessert0.setCuisineType(Dessert::FRENCH);
+//     Dessert0.getCuisineType();
+//     Dessert0.setFlavorProfile(Dessert::SWEET);
+//     Dessert0.getFlavorProfile();
+//     Dessert0.setSweetnessLevel(9);
+//     Dessert0.getSweetnessLevel();
+//     Dessert0.setContainsNuts(false);
+//     Dessert0.containsNuts();
+//     Dessert0.displayDessert();
+// }